@@ -8,32 +8,454 @@
 #include <lv2/urid/urid.h>
 #include <lv2/midi/midi.h>
 #include <lv2/state/state.h>
+#include <lv2/worker/worker.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#ifdef AYUMI_STATS
+#include <time.h>
+#endif
 #include "ayumi.h"
+#include "ayumi_pool.h"
+#include "ayumi_trace.h"
+#include "ayumi_upsample.h"
 
 #define AYUMI_LV2_URI "https://github.com/atsushieno/ayumi-lv2"
+#define AYUMI_LV2_STEMS_URI AYUMI_LV2_URI "#stems"
 #define AYUMI_LV2_ATOM_INPUT_PORT 0
 #define AYUMI_LV2_AUDIO_OUT_LEFT 1
 #define AYUMI_LV2_AUDIO_OUT_RIGHT 2
+#define AYUMI_LV2_CHIPS 3
+#define AYUMI_LV2_QUALITY 4
+#define AYUMI_LV2_CHIP_TYPE 5
+#define AYUMI_LV2_CLOCK 6
+#define AYUMI_LV2_STATS_TICK 7
+#define AYUMI_LV2_STATS_INTERPOLATE 8
+#define AYUMI_LV2_STATS_DECIMATE 9
+#define AYUMI_LV2_STATS_DC 10
+#define AYUMI_LV2_STATS_EVENTS 11
+#define AYUMI_LV2_STATS_TICKS 12
+#define AYUMI_LV2_STATS_WORST_RUN 13
+#define AYUMI_LV2_ENGINE 14
+#define AYUMI_LV2_AUDIO_OUT_A 15 // stems plugin only, up to AYUMI_LV2_AUDIO_OUT_C
+#define AYUMI_LV2_AUDIO_OUT_B 16
+#define AYUMI_LV2_AUDIO_OUT_C 17
+#define AYUMI_LV2_VOLUME 18 // channels A to C, as are the pan, mixer and tone ports; 15 in the stereo plugin
+#define AYUMI_LV2_PAN 21
+#define AYUMI_LV2_MIXER 24
+#define AYUMI_LV2_TONE 27
+#define AYUMI_LV2_NOISE 30
+#define AYUMI_LV2_ENVELOPE 31
+#define AYUMI_LV2_ENVELOPE_SHAPE 32
+#define AYUMI_LV2_RENDER_RATE 33 // 30 in the stereo plugin
+#define AYUMI_LV2_LATENCY 34 // 31 in the stereo plugin
+#define AYUMI_LV2_PORT_COUNT 35
+#define AYUMI_LV2_REGISTER_PORTS AYUMI_LV2_VOLUME // first of the ports that set a register, -1 leaves it to MIDI
+#define AYUMI_LV2_REGISTER_PORT_COUNT 15
+#define AYUMI_LV2_MAX_CHIPS 8
+#define AYUMI_LV2_POOL_MIN_CHIPS 4 // fewer chips are not worth a thread handoff
+#define AYUMI_LV2_CHUNK_SIZE 256
+#define AYUMI_LV2_CHUNK_OUTPUTS 5 // left, right and the three stems
+#define AYUMI_LV2_RENDER_RATE_MIN 44100 // the capped render rate is the host rate divided down to no less
+#define AYUMI_LV2_CLOCK_RATE 2000000
+#define AYUMI_LV2_CLOCK_MIN 1000000
+#define AYUMI_LV2_CLOCK_MAX 2500000
+#define AYUMI_LV2_BEND_RANGE 2 // semitones
+#define AYUMI_LV2_BEND_STEPS 32 // per semitone
+#define AYUMI_LV2_PERIOD_COUNT ((128 + 2 * AYUMI_LV2_BEND_RANGE) * AYUMI_LV2_BEND_STEPS)
 #define AYUMI_LV2_MIDI_CC_ENVELOPE_H 0x10
 #define AYUMI_LV2_MIDI_CC_ENVELOPE_M 0x11
 #define AYUMI_LV2_MIDI_CC_ENVELOPE_L 0x12
 #define AYUMI_LV2_MIDI_CC_ENVELOPE_SHAPE 0x13
 #define AYUMI_LV2_MIDI_CC_DC 0x50
+#define AYUMI_LV2_QUEUE_SIZE 512
+#define AYUMI_LV2_ALL_CHIPS 0xFF
+#define AYUMI_LV2_TRACE_ENV "AYUMI_LV2_TRACE" // directory the register traces are written to
+#define AYUMI_LV2_TRACE_CAPACITY 65536 // records, about 1 MB
+#define AYUMI_LV2_TRACE_BATCH 1024 // records worth waking the worker for before a second has passed
+#define AYUMI_LV2_STATE_URI AYUMI_LV2_URI "#state"
+#define AYUMI_LV2_STATE_VERSION 1
+
+// what a message to the worker asks for
+enum {
+	AYUMI_LV2_WORK_DRAIN, // write the pending trace records out
+	AYUMI_LV2_WORK_POOL // join the chip worker pool
+};
+
+typedef struct {
+	int key; // -1 when the voice is free
+	uint32_t age;
+} AyumiLV2Voice;
+
+// tone state of a PSG channel as of the last rendered frame
+typedef struct {
+	uint32_t period; // 8 fractional bits, 0 when no note sounds
+	uint32_t dither;
+	int tone;
+} AyumiLV2Tone;
+
+enum {
+	AYUMI_LV2_WRITE_NOTE_ON, // value is the period
+	AYUMI_LV2_WRITE_NOTE_OFF,
+	AYUMI_LV2_WRITE_PERIOD,
+	AYUMI_LV2_WRITE_MIXER, // tone off, noise off and envelope on in bits 0 to 2
+	AYUMI_LV2_WRITE_NOISE,
+	AYUMI_LV2_WRITE_VOLUME,
+	AYUMI_LV2_WRITE_PAN, // 0(L)...128(R)
+	AYUMI_LV2_WRITE_ENVELOPE,
+	AYUMI_LV2_WRITE_ENVELOPE_SHAPE,
+	AYUMI_LV2_WRITE_REMOVE_DC,
+	AYUMI_LV2_WRITE_COUNT
+};
+
+typedef struct {
+	uint32_t frame;
+	uint8_t type;
+	uint8_t chip; // or AYUMI_LV2_ALL_CHIPS
+	uint8_t channel;
+	uint32_t value;
+} AyumiLV2Write;
+
+// what LV2 state saves, the MIDI mapping and every chip
+typedef struct {
+	int mixer[3];
+	int32_t envelope;
+	int pitchbend[3];
+	uint32_t voice_age;
+	AyumiLV2Voice voices[AYUMI_LV2_MAX_CHIPS][3];
+	AyumiLV2Tone tones[AYUMI_LV2_MAX_CHIPS][3];
+	uint32_t shadow[AYUMI_LV2_MAX_CHIPS][AYUMI_LV2_WRITE_COUNT][3]; // which writes split a block decides the dither
+	struct ayumi_state chips[AYUMI_LV2_MAX_CHIPS];
+} AyumiLV2State;
 
 typedef struct {
 	LV2_URID_Map *urid_map;
 	LV2_URID midi_event_uri;
-	struct ayumi* impl;
+	LV2_URID state_uri;
+	LV2_URID chunk_uri;
+	struct ayumi* impl[AYUMI_LV2_MAX_CHIPS];
+	struct ayumi_stems* stems[AYUMI_LV2_MAX_CHIPS]; // NULL unless this is the stems plugin
+	int chip_count;
+	int quality;
+	int engine;
+	int is_ym;
+	double clock_rate;
 	int mixer[3];
 	int32_t envelope;
-	int32_t pitchbend;
+	int pitchbend[3]; // in bend steps
+	uint32_t periods[AYUMI_LV2_PERIOD_COUNT];
+	double tone_divisors[AYUMI_LV2_PERIOD_COUNT]; // clock rate / divisor is the period
 	double sample_rate;
 	const char * bundle_path;
-	float* ports[3];
+	float* ports[AYUMI_LV2_PORT_COUNT];
+	float registers[AYUMI_LV2_REGISTER_PORT_COUNT]; // register port values as of the last run
 	bool active;
-	bool note_on_state[3];
+	AyumiLV2Voice voices[AYUMI_LV2_MAX_CHIPS][3];
+	uint32_t voice_age;
+	AyumiLV2Tone tones[AYUMI_LV2_MAX_CHIPS][3];
+	AyumiLV2Write queue[AYUMI_LV2_QUEUE_SIZE];
+	int queue_length;
+	uint32_t frame; // frames of the current run already rendered
+	uint32_t shadow[AYUMI_LV2_MAX_CHIPS][AYUMI_LV2_WRITE_COUNT][3]; // last queued values
+	struct ayumi_pool* pool; // shared by all instances, NULL until enough chips are rendered, and on one core
+	_Atomic(struct ayumi_pool*) pool_created; // where the worker or activate() leaves it
+	bool pool_requested;
+	int chunk_frames;
+	float chunk[AYUMI_LV2_MAX_CHIPS][AYUMI_LV2_CHUNK_OUTPUTS][AYUMI_LV2_CHUNK_SIZE];
+	uint64_t position; // frames rendered since instantiation
+	int render_factor; // host frames per rendered frame, 1 at the host rate
+	struct ayumi_upsampler upsampler; // its factor is the one the render rate port switches to
+	float rendered[AYUMI_LV2_CHUNK_OUTPUTS][AYUMI_LV2_CHUNK_SIZE]; // chips at the capped rate
+	float last[AYUMI_LV2_CHUNK_OUTPUTS]; // last frame of every output, what the upsampler starts from
+	LV2_Worker_Schedule* schedule;
+	struct ayumi_trace* trace; // NULL unless AYUMI_LV2_TRACE is set
+	FILE* trace_file;
+	uint64_t trace_scheduled_at;
+	atomic_int trace_scheduled; // a drain is waiting for the worker
+	AyumiLV2State state; // as of the end of the last run
+	atomic_uint state_sequence; // odd while the audio thread updates state
+#ifdef AYUMI_STATS
+	uint32_t events; // MIDI events of the current run
+	double worst_run; // milliseconds, since activation
+#endif
 } AyumiLV2Handle;
 
+void ayumi_lv2_build_tone_divisors(AyumiLV2Handle *a) {
+	for (int i = 0; i < AYUMI_LV2_PERIOD_COUNT; i++) {
+		// We use equal temperament
+		// https://pages.mtu.edu/~suits/NoteFreqCalcs.html
+		double key = (double) i / AYUMI_LV2_BEND_STEPS - AYUMI_LV2_BEND_RANGE;
+		a->tone_divisors[i] = 16.0 * 220.0 * pow(2.0, (key - 45.0) / 12.0);
+	}
+}
+
+/*
+ * Tone periods from 2 semitones below key 0 to 2 above key 127 in bend
+ * steps, clamped to the 12-bit register, with 8 fractional bits. Only
+ * divides, so it is cheap enough for a clock change on the audio thread.
+ */
+void ayumi_lv2_build_periods(AyumiLV2Handle *a, double clock_rate) {
+	for (int i = 0; i < AYUMI_LV2_PERIOD_COUNT; i++) {
+		double period = clock_rate / a->tone_divisors[i];
+		period = period < 1 ? 1 : period > 4095 ? 4095 : period;
+		a->periods[i] = (uint32_t) (period * 256 + 0.5);
+	}
+}
+
+/*
+ * Records a call into the core at the current frame, for ayumi_replay.
+ * Safe on the audio thread: when the ring is full the record is lost and
+ * the trace says so.
+ */
+void ayumi_lv2_trace(AyumiLV2Handle* a, int op, int chip, int channel, int flag, int32_t value) {
+	if (!a->trace)
+		return;
+	struct ayumi_trace_record r = { a->position, op, chip, channel, flag, { value } };
+	ayumi_trace_push(a->trace, &r);
+}
+
+void ayumi_lv2_trace_real(AyumiLV2Handle* a, int op, int chip, int channel, int flag, float value) {
+	if (!a->trace)
+		return;
+	struct ayumi_trace_record r = { a->position, op, chip, channel, flag, { 0 } };
+	r.value.f = value;
+	ayumi_trace_push(a->trace, &r);
+}
+
+// A restored chip: its state word by word, then the record that loads it
+void ayumi_lv2_trace_state(AyumiLV2Handle* a, int chip, const struct ayumi_state* state) {
+	if (!a->trace)
+		return;
+	int32_t words[AYUMI_TRACE_STATE_WORDS];
+	ayumi_trace_pack_state(state, words);
+	for (int i = 0; i < AYUMI_TRACE_STATE_WORDS; i++)
+		ayumi_lv2_trace(a, AYUMI_TRACE_STATE, chip, i, 0, words[i]);
+	ayumi_lv2_trace(a, AYUMI_TRACE_RESTORE, chip, 0, 0, 0);
+}
+
+/*
+ * With AYUMI_LV2_TRACE set to a directory, every instance records to
+ * ayumi-lv2-<pid>-<n>.aytrace in it.
+ */
+void ayumi_lv2_trace_open(AyumiLV2Handle* a, int flags) {
+	static atomic_int instances;
+	const char* dir = getenv(AYUMI_LV2_TRACE_ENV);
+	if (!dir || !*dir)
+		return;
+	char path[4096];
+	snprintf(path, sizeof(path), "%s/ayumi-lv2-%ld-%d.aytrace", dir, (long) getpid(), atomic_fetch_add(&instances, 1));
+	a->trace_file = fopen(path, "wb");
+	if (!a->trace_file)
+		return;
+	a->trace = ayumi_trace_create(AYUMI_LV2_TRACE_CAPACITY);
+	if (!a->trace || ayumi_trace_write_header(a->trace_file, (int) a->sample_rate, flags)) {
+		ayumi_trace_destroy(a->trace);
+		a->trace = NULL;
+		fclose(a->trace_file);
+		a->trace_file = NULL;
+	}
+}
+
+// not on the audio thread, the ring has a single reader
+void ayumi_lv2_trace_drain(AyumiLV2Handle* a) {
+	if (ayumi_trace_drain(a->trace, a->trace_file) >= 0)
+		fflush(a->trace_file);
+}
+
+/*
+ * Hands the drain to the worker once enough records are waiting, or a
+ * second after the last drain, so it is not woken on every run.
+ */
+void ayumi_lv2_trace_schedule(AyumiLV2Handle* a) {
+	if (!a->schedule || atomic_load_explicit(&a->trace_scheduled, memory_order_acquire))
+		return;
+	int pending = ayumi_trace_pending(a->trace);
+	if (pending == 0 || (pending < AYUMI_LV2_TRACE_BATCH && a->position - a->trace_scheduled_at < a->sample_rate))
+		return;
+	uint32_t message = AYUMI_LV2_WORK_DRAIN;
+	a->trace_scheduled_at = a->position;
+	atomic_store_explicit(&a->trace_scheduled, 1, memory_order_relaxed);
+	if (a->schedule->schedule_work(a->schedule->handle, sizeof(message), &message) != LV2_WORKER_SUCCESS)
+		atomic_store_explicit(&a->trace_scheduled, 0, memory_order_relaxed);
+}
+
+/*
+ * LV2 state may be saved while run() plays, so the audio thread copies
+ * what it owns to a->state at the end of every run, under a sequence
+ * count the saving thread checks for a torn copy.
+ */
+void ayumi_lv2_publish_state(AyumiLV2Handle* a) {
+	AyumiLV2State* s = &a->state;
+	unsigned sequence = atomic_load_explicit(&a->state_sequence, memory_order_relaxed);
+	atomic_store_explicit(&a->state_sequence, sequence + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	memcpy(s->mixer, a->mixer, sizeof(s->mixer));
+	s->envelope = a->envelope;
+	memcpy(s->pitchbend, a->pitchbend, sizeof(s->pitchbend));
+	s->voice_age = a->voice_age;
+	memcpy(s->voices, a->voices, sizeof(s->voices));
+	memcpy(s->tones, a->tones, sizeof(s->tones));
+	memcpy(s->shadow, a->shadow, sizeof(s->shadow));
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++)
+		ayumi_save_state(a->impl[c], &s->chips[c]);
+	atomic_store_explicit(&a->state_sequence, sequence + 2, memory_order_release);
+}
+
+void ayumi_lv2_read_state(AyumiLV2Handle* a, AyumiLV2State* s) {
+	unsigned before, after;
+	do {
+		before = atomic_load_explicit(&a->state_sequence, memory_order_acquire);
+		memcpy(s, &a->state, sizeof(AyumiLV2State));
+		atomic_thread_fence(memory_order_acquire);
+		after = atomic_load_explicit(&a->state_sequence, memory_order_relaxed);
+	} while ((before & 1) || before != after);
+}
+
+// little endian 32-bit words, reads and writes past the end set overflow
+typedef struct {
+	uint8_t* data;
+	size_t size;
+	size_t offset;
+	bool overflow;
+} AyumiLV2Blob;
+
+void ayumi_lv2_blob_put(AyumiLV2Blob* b, uint32_t x) {
+	if (b->offset + 4 > b->size) {
+		b->overflow = true;
+		return;
+	}
+	for (int i = 0; i < 4; i++)
+		b->data[b->offset++] = x >> (i * 8);
+}
+
+uint32_t ayumi_lv2_blob_get(AyumiLV2Blob* b) {
+	uint32_t x = 0;
+	if (b->offset + 4 > b->size) {
+		b->overflow = true;
+		return 0;
+	}
+	for (int i = 0; i < 4; i++)
+		x |= (uint32_t) b->data[b->offset++] << (i * 8);
+	return x;
+}
+
+void ayumi_lv2_blob_put_double(AyumiLV2Blob* b, double x) {
+	uint64_t bits;
+	memcpy(&bits, &x, sizeof(bits));
+	ayumi_lv2_blob_put(b, (uint32_t) bits);
+	ayumi_lv2_blob_put(b, (uint32_t) (bits >> 32));
+}
+
+double ayumi_lv2_blob_get_double(AyumiLV2Blob* b) {
+	uint64_t bits = ayumi_lv2_blob_get(b);
+	bits |= (uint64_t) ayumi_lv2_blob_get(b) << 32;
+	double x;
+	memcpy(&x, &bits, sizeof(x));
+	return x;
+}
+
+/*
+ * "AYST", the version and the chip count, then the MIDI mapping and the
+ * voices, tones, last queued writes and registers of each chip. Every
+ * field is a word but pans and the tick phase, which are doubles.
+ */
+void ayumi_lv2_encode_state(const AyumiLV2State* s, AyumiLV2Blob* b) {
+	ayumi_lv2_blob_put(b, 0x54535941); // "AYST"
+	ayumi_lv2_blob_put(b, AYUMI_LV2_STATE_VERSION);
+	ayumi_lv2_blob_put(b, AYUMI_LV2_MAX_CHIPS);
+	for (int i = 0; i < 3; i++) {
+		ayumi_lv2_blob_put(b, s->mixer[i]);
+		ayumi_lv2_blob_put(b, s->pitchbend[i]);
+	}
+	ayumi_lv2_blob_put(b, s->envelope);
+	ayumi_lv2_blob_put(b, s->voice_age);
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++) {
+		const struct ayumi_state* chip = &s->chips[c];
+		for (int i = 0; i < 3; i++) {
+			ayumi_lv2_blob_put(b, s->voices[c][i].key);
+			ayumi_lv2_blob_put(b, s->voices[c][i].age);
+			ayumi_lv2_blob_put(b, s->tones[c][i].period);
+			ayumi_lv2_blob_put(b, s->tones[c][i].dither);
+			ayumi_lv2_blob_put(b, s->tones[c][i].tone);
+			ayumi_lv2_blob_put(b, chip->tone_period[i]);
+			ayumi_lv2_blob_put(b, chip->tone_counter[i]);
+			ayumi_lv2_blob_put(b, chip->tone[i]);
+			ayumi_lv2_blob_put(b, chip->mixer[i]);
+			ayumi_lv2_blob_put(b, chip->volume[i]);
+			ayumi_lv2_blob_put_double(b, chip->pan_left[i]);
+			ayumi_lv2_blob_put_double(b, chip->pan_right[i]);
+			for (int w = 0; w < AYUMI_LV2_WRITE_COUNT; w++)
+				ayumi_lv2_blob_put(b, s->shadow[c][w][i]);
+		}
+		ayumi_lv2_blob_put(b, chip->noise_period);
+		ayumi_lv2_blob_put(b, chip->noise_counter);
+		ayumi_lv2_blob_put(b, chip->noise);
+		ayumi_lv2_blob_put(b, chip->envelope_period);
+		ayumi_lv2_blob_put(b, chip->envelope_counter);
+		ayumi_lv2_blob_put(b, chip->envelope_shape);
+		ayumi_lv2_blob_put(b, chip->envelope_step);
+		ayumi_lv2_blob_put_double(b, chip->x);
+	}
+}
+
+// returns false unless the blob is a whole state of this version
+bool ayumi_lv2_decode_state(AyumiLV2State* s, AyumiLV2Blob* b) {
+	if (ayumi_lv2_blob_get(b) != 0x54535941 || ayumi_lv2_blob_get(b) != AYUMI_LV2_STATE_VERSION
+		|| ayumi_lv2_blob_get(b) != AYUMI_LV2_MAX_CHIPS)
+		return false;
+	for (int i = 0; i < 3; i++) {
+		s->mixer[i] = (int32_t) ayumi_lv2_blob_get(b);
+		s->pitchbend[i] = (int32_t) ayumi_lv2_blob_get(b);
+	}
+	s->envelope = (int32_t) ayumi_lv2_blob_get(b);
+	s->voice_age = ayumi_lv2_blob_get(b);
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++) {
+		struct ayumi_state* chip = &s->chips[c];
+		for (int i = 0; i < 3; i++) {
+			s->voices[c][i].key = (int32_t) ayumi_lv2_blob_get(b);
+			s->voices[c][i].age = ayumi_lv2_blob_get(b);
+			s->tones[c][i].period = ayumi_lv2_blob_get(b);
+			s->tones[c][i].dither = ayumi_lv2_blob_get(b);
+			s->tones[c][i].tone = (int32_t) ayumi_lv2_blob_get(b);
+			chip->tone_period[i] = (int32_t) ayumi_lv2_blob_get(b);
+			chip->tone_counter[i] = (int32_t) ayumi_lv2_blob_get(b);
+			chip->tone[i] = (int32_t) ayumi_lv2_blob_get(b);
+			chip->mixer[i] = (int32_t) ayumi_lv2_blob_get(b);
+			chip->volume[i] = (int32_t) ayumi_lv2_blob_get(b);
+			chip->pan_left[i] = ayumi_lv2_blob_get_double(b);
+			chip->pan_right[i] = ayumi_lv2_blob_get_double(b);
+			for (int w = 0; w < AYUMI_LV2_WRITE_COUNT; w++)
+				s->shadow[c][w][i] = ayumi_lv2_blob_get(b);
+		}
+		chip->noise_period = (int32_t) ayumi_lv2_blob_get(b);
+		chip->noise_counter = (int32_t) ayumi_lv2_blob_get(b);
+		chip->noise = (int32_t) ayumi_lv2_blob_get(b);
+		chip->envelope_period = (int32_t) ayumi_lv2_blob_get(b);
+		chip->envelope_counter = (int32_t) ayumi_lv2_blob_get(b);
+		chip->envelope_shape = (int32_t) ayumi_lv2_blob_get(b);
+		chip->envelope_step = (int32_t) ayumi_lv2_blob_get(b);
+		chip->x = ayumi_lv2_blob_get_double(b);
+	}
+	return !b->overflow && b->offset == b->size;
+}
+
+void ayumi_lv2_apply(AyumiLV2Handle *a, const AyumiLV2Write* w);
+
+// chip state at instantiation, every write goes to all chips
+static const AyumiLV2Write ayumi_lv2_initial_writes[] = {
+	{ 0, AYUMI_LV2_WRITE_NOISE, AYUMI_LV2_ALL_CHIPS, 0, 4 }, // pink noise by default
+	{ 0, AYUMI_LV2_WRITE_ENVELOPE_SHAPE, AYUMI_LV2_ALL_CHIPS, 0, 14 }, // see http://fmpdoc.fmp.jp/%E3%82%A8%E3%83%B3%E3%83%99%E3%83%AD%E3%83%BC%E3%83%97%E3%83%8F%E3%83%BC%E3%83%89%E3%82%A6%E3%82%A7%E3%82%A2/
+	{ 0, AYUMI_LV2_WRITE_ENVELOPE, AYUMI_LV2_ALL_CHIPS, 0, 0x40 }, // somewhat slow
+	{ 0, AYUMI_LV2_WRITE_PAN, AYUMI_LV2_ALL_CHIPS, 0, 64 }, // 0(L)...128(R)
+	{ 0, AYUMI_LV2_WRITE_PAN, AYUMI_LV2_ALL_CHIPS, 1, 64 },
+	{ 0, AYUMI_LV2_WRITE_PAN, AYUMI_LV2_ALL_CHIPS, 2, 64 },
+	{ 0, AYUMI_LV2_WRITE_MIXER, AYUMI_LV2_ALL_CHIPS, 0, 3 }, // should be quiet by default
+	{ 0, AYUMI_LV2_WRITE_MIXER, AYUMI_LV2_ALL_CHIPS, 1, 3 },
+	{ 0, AYUMI_LV2_WRITE_MIXER, AYUMI_LV2_ALL_CHIPS, 2, 3 },
+	{ 0, AYUMI_LV2_WRITE_VOLUME, AYUMI_LV2_ALL_CHIPS, 0, 14 }, // FIXME: max = 14?? 15 doesn't work
+	{ 0, AYUMI_LV2_WRITE_VOLUME, AYUMI_LV2_ALL_CHIPS, 1, 14 },
+	{ 0, AYUMI_LV2_WRITE_VOLUME, AYUMI_LV2_ALL_CHIPS, 2, 14 }
+};
+
 LV2_Handle ayumi_lv2_instantiate(
 		const LV2_Descriptor * descriptor,
 		double sample_rate,
@@ -41,30 +463,56 @@ LV2_Handle ayumi_lv2_instantiate(
 		const LV2_Feature *const * features) {
 	AyumiLV2Handle* handle = (AyumiLV2Handle*) calloc(sizeof(AyumiLV2Handle), 1);
 	handle->active = false;
-	handle->impl = calloc(sizeof(struct ayumi), 1);
 	handle->sample_rate = sample_rate;
 	handle->bundle_path = strdup(bundle_path);
+	handle->chip_count = 1;
+	handle->quality = AYUMI_QUALITY_STANDARD;
+	handle->engine = AYUMI_ENGINE_FIR;
+	handle->is_ym = 1;
+	handle->clock_rate = AYUMI_LV2_CLOCK_RATE;
+	handle->render_factor = 1;
+	memset(handle->shadow, 0xFF, sizeof(handle->shadow)); // unknown, so the first writes are never dropped
+	for (int i = 0; i < AYUMI_LV2_REGISTER_PORT_COUNT; i++)
+		handle->registers[i] = -1;
+	ayumi_lv2_build_tone_divisors(handle);
+	ayumi_lv2_build_periods(handle, AYUMI_LV2_CLOCK_RATE);
+	int stems = !strcmp(descriptor->URI, AYUMI_LV2_STEMS_URI);
+	ayumi_upsample_configure(&handle->upsampler, ayumi_upsample_factor((int) sample_rate, AYUMI_LV2_RENDER_RATE_MIN),
+		stems ? AYUMI_LV2_CHUNK_OUTPUTS : 2);
+	ayumi_lv2_trace_open(handle, stems ? AYUMI_TRACE_STEMS : 0);
+	ayumi_lv2_trace(handle, AYUMI_TRACE_CHIPS, 0, 0, 0, handle->chip_count);
 
-	/* clock_rate / (sample_rate * 8 * 8) must be < 1.0 */
-	ayumi_configure(handle->impl, 1, 2000000, (int) sample_rate);
-	ayumi_set_noise(handle->impl, 4); // pink noise by default
-	for (int i = 0; i < 3; i++) {
-		handle->mixer[i] = 1 << 6; // tone, without envelope
-		ayumi_set_pan(handle->impl, i, 0.5, 0); // 0(L)...1(R)
-		ayumi_set_mixer(handle->impl, i, 1, 1, 0); // should be quiet by default
-		ayumi_set_envelope_shape(handle->impl, 14); // see http://fmpdoc.fmp.jp/%E3%82%A8%E3%83%B3%E3%83%99%E3%83%AD%E3%83%BC%E3%83%97%E3%83%8F%E3%83%BC%E3%83%89%E3%82%A6%E3%82%A7%E3%82%A2/
-		ayumi_set_envelope(handle->impl, 0x40); // somewhat slow
-		ayumi_set_volume(handle->impl, i, 14); // FIXME: max = 14?? 15 doesn't work
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++) {
+		struct ayumi* impl = aligned_alloc(64, sizeof(struct ayumi)); // struct ayumi is cache line aligned
+		handle->impl[c] = impl;
+		/* clock_rate / (sample_rate * 8 * 8) must be < 1.0 */
+		ayumi_configure(impl, 1, AYUMI_LV2_CLOCK_RATE, (int) sample_rate);
+		ayumi_lv2_trace_real(handle, AYUMI_TRACE_CONFIGURE, c, 0, 1, AYUMI_LV2_CLOCK_RATE);
+		for (int i = 0; i < 3; i++) {
+			handle->mixer[i] = 1 << 6; // tone, without envelope
+			handle->voices[c][i].key = -1;
+		}
+		if (stems) {
+			handle->stems[c] = aligned_alloc(64, sizeof(struct ayumi_stems));
+			ayumi_stems_configure(handle->stems[c], impl);
+		}
 	}
+	for (size_t i = 0; i < sizeof(ayumi_lv2_initial_writes) / sizeof(AyumiLV2Write); i++)
+		ayumi_lv2_apply(handle, &ayumi_lv2_initial_writes[i]);
 
 	handle->urid_map = NULL;
 	for (int i = 0; features[i]; i++) {
 		const LV2_Feature* f = features[i];
 		if (!strcmp(f->URI, LV2_URID__map))
 			handle->urid_map = (LV2_URID_Map*) f->data;
+		else if (!strcmp(f->URI, LV2_WORKER__schedule))
+			handle->schedule = (LV2_Worker_Schedule*) f->data;
 	}
 	assert(handle->urid_map);
 	handle->midi_event_uri = handle->urid_map->map(handle->urid_map->handle, LV2_MIDI__MidiEvent);
+	handle->state_uri = handle->urid_map->map(handle->urid_map->handle, AYUMI_LV2_STATE_URI);
+	handle->chunk_uri = handle->urid_map->map(handle->urid_map->handle, LV2_ATOM__Chunk);
+	ayumi_lv2_publish_state(handle);
 
 	return handle;
 }
@@ -74,150 +522,761 @@ void ayumi_lv2_connect_port(
 		uint32_t port,
 		void * data_location) {
 	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
-	a->ports[port] = data_location;
+	// the stereo plugin has no stem outputs, its register ports follow the engine port
+	if (!a->stems[0] && port >= AYUMI_LV2_AUDIO_OUT_A)
+		port += AYUMI_LV2_REGISTER_PORTS - AYUMI_LV2_AUDIO_OUT_A;
+	if (port < AYUMI_LV2_PORT_COUNT)
+		a->ports[port] = data_location;
+}
+
+// the calling thread renders too, so one worker less than cores, for all instances together
+struct ayumi_pool* ayumi_lv2_create_pool(void) {
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	return cores > 1 ? ayumi_pool_acquire(cores - 1) : NULL;
 }
 
 void ayumi_lv2_activate(LV2_Handle instance) {
 	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
 	a->active = true;
+	// without a worker the pool can only be created here, if the chips port already asks for it
+	float* chips = a->ports[AYUMI_LV2_CHIPS];
+	if (!a->schedule && !a->pool_requested && chips && *chips >= AYUMI_LV2_POOL_MIN_CHIPS) {
+		a->pool_requested = true;
+		atomic_store_explicit(&a->pool_created, ayumi_lv2_create_pool(), memory_order_release);
+	}
+	// without AYUMI_STATS the statistics ports stay at 0
+	for (int i = AYUMI_LV2_STATS_TICK; i <= AYUMI_LV2_STATS_WORST_RUN; i++)
+		if (a->ports[i])
+			*a->ports[i] = 0;
+#ifdef AYUMI_STATS
+	a->worst_run = 0;
+#endif
+}
+
+/*
+ * With one chip every MIDI channel owns its PSG channel and notes played
+ * while it sounds are dropped. With more chips, notes of MIDI channel n
+ * are spread over PSG channel n of every chip, and the oldest voice is
+ * stolen when all of them are busy.
+ */
+int ayumi_lv2_voice_on(AyumiLV2Handle *a, int channel, int key) {
+	int chip = 0;
+	if (a->chip_count == 1 && a->voices[0][channel].key >= 0)
+		return -1; // busy
+	for (int c = 0; c < a->chip_count; c++) {
+		if (a->voices[c][channel].key < 0) {
+			chip = c;
+			break;
+		}
+		if (a->voices[c][channel].age < a->voices[chip][channel].age)
+			chip = c;
+	}
+	a->voices[chip][channel].key = key;
+	a->voices[chip][channel].age = a->voice_age++;
+	return chip;
+}
+
+uint32_t ayumi_lv2_period(AyumiLV2Handle *a, int channel, int key) {
+	return a->periods[(key + AYUMI_LV2_BEND_RANGE) * AYUMI_LV2_BEND_STEPS + a->pitchbend[channel]];
+}
+
+/*
+ * An integer period detunes high notes, so the fractional part is carried
+ * over from one call to the next and the average pitch is exact.
+ */
+void ayumi_lv2_update_tone(AyumiLV2Handle *a, int chip, int channel) {
+	AyumiLV2Tone* t = &a->tones[chip][channel];
+	t->dither += t->period & 0xFF;
+	int tone = (t->period >> 8) + (t->dither >> 8);
+	t->dither &= 0xFF;
+	if (tone != t->tone) {
+		t->tone = tone;
+		ayumi_set_tone(a->impl[chip], channel, tone);
+		ayumi_lv2_trace(a, AYUMI_TRACE_TONE, chip, channel, 0, tone);
+	}
+}
+
+// the core calls a write makes, except the tone which depends on the chip
+void ayumi_lv2_trace_write(AyumiLV2Handle *a, const AyumiLV2Write* w) {
+	static const int ops[AYUMI_LV2_WRITE_COUNT] = {
+		-1, -1, -1, AYUMI_TRACE_MIXER, AYUMI_TRACE_NOISE, AYUMI_TRACE_VOLUME, AYUMI_TRACE_PAN,
+		AYUMI_TRACE_ENVELOPE, AYUMI_TRACE_ENVELOPE_SHAPE, AYUMI_TRACE_REMOVE_DC
+	};
+	if (w->type == AYUMI_LV2_WRITE_PAN)
+		ayumi_lv2_trace_real(a, AYUMI_TRACE_PAN, w->chip, w->channel, 0, w->value / 128.0f);
+	else if (ops[w->type] >= 0)
+		ayumi_lv2_trace(a, ops[w->type], w->chip, w->channel, 0, w->value);
+}
+
+void ayumi_lv2_apply(AyumiLV2Handle *a, const AyumiLV2Write* w) {
+	int first = w->chip == AYUMI_LV2_ALL_CHIPS ? 0 : w->chip;
+	int last = w->chip == AYUMI_LV2_ALL_CHIPS ? AYUMI_LV2_MAX_CHIPS : w->chip + 1;
+	int channel = w->channel;
+	uint32_t value = w->value;
+	if (a->trace)
+		ayumi_lv2_trace_write(a, w);
+	for (int c = first; c < last; c++) {
+		struct ayumi* impl = a->impl[c];
+		AyumiLV2Tone* t = &a->tones[c][channel];
+		switch (w->type) {
+		case AYUMI_LV2_WRITE_NOTE_ON:
+			t->dither = 0;
+			t->tone = -1;
+			// fall through
+		case AYUMI_LV2_WRITE_PERIOD:
+			t->period = value;
+			ayumi_lv2_update_tone(a, c, channel);
+			break;
+		case AYUMI_LV2_WRITE_NOTE_OFF:
+			t->period = 0;
+			break;
+		case AYUMI_LV2_WRITE_MIXER:
+			ayumi_set_mixer(impl, channel, value & 1, (value >> 1) & 1, (value >> 2) & 1);
+			break;
+		case AYUMI_LV2_WRITE_NOISE:
+			ayumi_set_noise(impl, value);
+			break;
+		case AYUMI_LV2_WRITE_VOLUME:
+			ayumi_set_volume(impl, channel, value);
+			break;
+		case AYUMI_LV2_WRITE_PAN:
+			ayumi_set_pan(impl, channel, value / 128.0, 0);
+			break;
+		case AYUMI_LV2_WRITE_ENVELOPE:
+			ayumi_set_envelope(impl, value);
+			break;
+		case AYUMI_LV2_WRITE_ENVELOPE_SHAPE:
+			ayumi_set_envelope_shape(impl, value);
+			break;
+		case AYUMI_LV2_WRITE_REMOVE_DC:
+			ayumi_remove_dc(impl);
+			break;
+		}
+	}
+}
+
+int ayumi_lv2_voice_off(AyumiLV2Handle *a, int channel, int key) {
+	for (int c = 0; c < a->chip_count; c++) {
+		AyumiLV2Voice* v = &a->voices[c][channel];
+		if (v->key >= 0 && (a->chip_count == 1 || v->key == key)) {
+			v->key = -1;
+			return c;
+		}
+	}
+	return -1; // not at note on state
+}
+
+/*
+ * Renders count frames of a chip. The stems plugin ticks the chip once
+ * for its stems and their panned sum.
+ */
+void ayumi_lv2_process(AyumiLV2Handle* a, int chip, float** out, int count) {
+	if (a->stems[chip])
+		ayumi_process_stems(a->impl[chip], a->stems[chip], out + 2, out[0], out[1], count, 1);
+	else
+		ayumi_process_block(a->impl[chip], out[0], out[1], count, 1);
+}
+
+void ayumi_lv2_render_chip(void* context, int index) {
+	AyumiLV2Handle* a = (AyumiLV2Handle*) context;
+	float* out[AYUMI_LV2_CHUNK_OUTPUTS];
+	for (int o = 0; o < AYUMI_LV2_CHUNK_OUTPUTS; o++)
+		out[o] = a->chunk[index][o];
+	ayumi_lv2_process(a, index, out, a->chunk_frames);
+}
+
+void ayumi_lv2_render_chips(AyumiLV2Handle* a, float** out, int count) {
+	int outputs = a->stems[0] ? AYUMI_LV2_CHUNK_OUTPUTS : 2;
+	a->chunk_frames = count;
+	if (a->pool && a->chip_count >= AYUMI_LV2_POOL_MIN_CHIPS) {
+		ayumi_pool_run(a->pool, ayumi_lv2_render_chip, a, a->chip_count);
+	} else {
+		for (int c = 0; c < a->chip_count; c++)
+			ayumi_lv2_render_chip(a, c);
+	}
+	// sum in chip order so the result does not depend on the scheduling
+	for (int o = 0; o < outputs; o++) {
+		if (!out[o])
+			continue;
+		for (int i = 0; i < count; i++) {
+			float sum = 0;
+			for (int c = 0; c < a->chip_count; c++)
+				sum += a->chunk[c][o][i];
+			out[o][i] = sum;
+		}
+	}
+}
+
+// output ports in chunk order, stem ports are NULL in the stereo plugin
+static const int ayumi_lv2_output_ports[AYUMI_LV2_CHUNK_OUTPUTS] = {
+	AYUMI_LV2_AUDIO_OUT_LEFT, AYUMI_LV2_AUDIO_OUT_RIGHT,
+	AYUMI_LV2_AUDIO_OUT_A, AYUMI_LV2_AUDIO_OUT_B, AYUMI_LV2_AUDIO_OUT_C
+};
+
+void ayumi_lv2_render_frames(AyumiLV2Handle* a, float** out, int count) {
+	if (a->chip_count == 1)
+		ayumi_lv2_process(a, 0, out, count);
+	else
+		ayumi_lv2_render_chips(a, out, count);
+}
+
+/*
+ * At a capped render rate every chunk renders the frames the upsampler
+ * needs for it, at most half a chunk. A write at host frame f lands
+ * after ceil(f / factor) rendered frames, whatever the block size.
+ */
+void ayumi_lv2_render(AyumiLV2Handle* a, int offset, int count) {
+	float* out[AYUMI_LV2_CHUNK_OUTPUTS];
+	float* rendered[AYUMI_LV2_CHUNK_OUTPUTS];
+	for (int o = 0; o < AYUMI_LV2_CHUNK_OUTPUTS; o++) {
+		float* port = a->ports[ayumi_lv2_output_ports[o]];
+		out[o] = port ? port + offset : NULL;
+		rendered[o] = a->rendered[o];
+	}
+	while (count > 0) {
+		int n = count < AYUMI_LV2_CHUNK_SIZE ? count : AYUMI_LV2_CHUNK_SIZE;
+		for (int c = 0; c < a->chip_count; c++)
+			for (int i = 0; i < 3; i++)
+				if (a->tones[c][i].period)
+					ayumi_lv2_update_tone(a, c, i);
+		if (a->render_factor > 1) {
+			int frames = ayumi_upsample_needed(&a->upsampler, n);
+			if (frames > 0)
+				ayumi_lv2_render_frames(a, rendered, frames);
+			ayumi_upsample_process(&a->upsampler, rendered, out, n);
+		} else {
+			ayumi_lv2_render_frames(a, out, n);
+		}
+		a->position += n;
+		for (int o = 0; o < AYUMI_LV2_CHUNK_OUTPUTS; o++) {
+			if (!out[o])
+				continue;
+			a->last[o] = out[o][n - 1];
+			out[o] += n;
+		}
+		count -= n;
+	}
 }
 
-double key_to_freq(double key) {
-    // We use equal temperament
-    // https://pages.mtu.edu/~suits/NoteFreqCalcs.html
-    double ret = 220.0 * pow(1.059463, key - 45.0);
-    return ret;
+/*
+ * Renders up to each queued write and applies it, then up to frame.
+ */
+void ayumi_lv2_flush(AyumiLV2Handle* a, uint32_t frame) {
+	for (int i = 0; i < a->queue_length; i++) {
+		AyumiLV2Write* w = &a->queue[i];
+		if (w->frame > a->frame) {
+			ayumi_lv2_render(a, a->frame, w->frame - a->frame);
+			a->frame = w->frame;
+		}
+		ayumi_lv2_apply(a, w);
+	}
+	a->queue_length = 0;
+	if (frame > a->frame) {
+		ayumi_lv2_render(a, a->frame, frame - a->frame);
+		a->frame = frame;
+	}
 }
 
-void ayumi_lv2_process_midi_event(AyumiLV2Handle *a, LV2_Atom_Event *ev) {
-	int noise, tone_switch, noise_switch, env_switch;
+/*
+ * Writes that leave every register they target as it was are dropped, so
+ * a stream of repeated controller values does not split the block.
+ */
+void ayumi_lv2_queue(AyumiLV2Handle* a, uint32_t frame, int type, int chip, int channel, uint32_t value) {
+	int first = chip == AYUMI_LV2_ALL_CHIPS ? 0 : chip;
+	int last = chip == AYUMI_LV2_ALL_CHIPS ? AYUMI_LV2_MAX_CHIPS : chip + 1;
+	bool changed = false;
+	switch (type) {
+	case AYUMI_LV2_WRITE_NOTE_ON:
+		a->shadow[chip][AYUMI_LV2_WRITE_PERIOD][channel] = value;
+		changed = true;
+		break;
+	case AYUMI_LV2_WRITE_NOTE_OFF:
+	case AYUMI_LV2_WRITE_ENVELOPE_SHAPE: // restarts the envelope
+	case AYUMI_LV2_WRITE_REMOVE_DC:
+		changed = true;
+		break;
+	default:
+		for (int c = first; c < last; c++) {
+			if (a->shadow[c][type][channel] != value) {
+				a->shadow[c][type][channel] = value;
+				changed = true;
+			}
+		}
+		break;
+	}
+	if (!changed)
+		return;
+	if (a->queue_length == AYUMI_LV2_QUEUE_SIZE)
+		ayumi_lv2_flush(a, frame);
+	AyumiLV2Write* w = &a->queue[a->queue_length++];
+	w->frame = frame;
+	w->type = type;
+	w->chip = chip;
+	w->channel = channel;
+	w->value = value;
+}
+
+/*
+ * Runs ahead of rendering: voices are allocated right away, while the chip
+ * state only changes when the renderer reaches the frame of the write.
+ */
+void ayumi_lv2_process_midi_event(AyumiLV2Handle *a, LV2_Atom_Event *ev, uint32_t frame) {
 	uint8_t * msg = (uint8_t *)(ev + 1);
 	int channel = msg[0] & 0xF;
 	if (channel > 2)
 		return;
-	int mixer;
+	int mixer, chip;
 	switch (lv2_midi_message_type(msg)) {
 	case LV2_MIDI_MSG_NOTE_OFF: note_off:
-		if (!a->note_on_state[channel])
+		chip = ayumi_lv2_voice_off(a, channel, msg[1]);
+		if (chip < 0)
 			break; // not at note on state
-		ayumi_set_mixer(a->impl, channel, 1, 1, 0);
-		a->note_on_state[channel] = false;
+		ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_MIXER, chip, channel, 3);
+		ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_NOTE_OFF, chip, channel, 0);
 		break;
 	case LV2_MIDI_MSG_NOTE_ON:
 		if (msg[2] == 0)
 			goto note_off; // it is illegal though.
-		if (a->note_on_state[channel])
+		chip = ayumi_lv2_voice_on(a, channel, msg[1]);
+		if (chip < 0)
 			break; // busy
-		mixer = a->mixer[channel];
-		tone_switch = (mixer >> 5) & 1;
-		noise_switch = (mixer >> 6) & 1;
-		env_switch = (mixer >> 7) & 1;
-		ayumi_set_mixer(a->impl, channel, tone_switch, noise_switch, env_switch);
-		ayumi_set_tone(a->impl, channel, 2000000.0 / (16.0 * key_to_freq(msg[1])));
-		a->note_on_state[channel] = true;
+		ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_MIXER, chip, channel, (a->mixer[channel] >> 5) & 7);
+		ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_NOTE_ON, chip, channel, ayumi_lv2_period(a, channel, msg[1]));
 		break;
 	case LV2_MIDI_MSG_PGM_CHANGE:
-		noise = msg[1] & 0x1F;
-		ayumi_set_noise(a->impl, noise);
-		mixer = msg[1];
-		tone_switch = (mixer >> 5) & 1;
-		noise_switch = (mixer >> 6) & 1;
-		// We cannot pass 8 bit message, so we remove env_switch here. Use BankMSB for it.
-		env_switch = (a->mixer[channel] >> 7) & 1;
+		ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_NOISE, AYUMI_LV2_ALL_CHIPS, 0, msg[1] & 0x1F);
+		// We cannot pass 8 bit message, so we keep env_switch here. Use BankMSB for it.
+		mixer = ((msg[1] >> 5) & 3) | (((a->mixer[channel] >> 7) & 1) << 2);
 		a->mixer[channel] = msg[1];
-		ayumi_set_mixer(a->impl, channel, tone_switch, noise_switch, env_switch);
+		ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_MIXER, AYUMI_LV2_ALL_CHIPS, channel, mixer);
 		break;
 	case LV2_MIDI_MSG_CONTROLLER:
 		switch (msg[1]) {
 		case LV2_MIDI_CTL_MSB_BANK:
 			mixer = msg[1];
-			tone_switch = mixer & 1;
-			noise_switch = (mixer >> 1) & 1;
-			env_switch = (mixer >> 2) & 1;
 			a->mixer[channel] = msg[1];
-			ayumi_set_mixer(a->impl, channel, tone_switch, noise_switch, env_switch);
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_MIXER, AYUMI_LV2_ALL_CHIPS, channel, mixer & 7);
 			break;
 		case LV2_MIDI_CTL_MSB_PAN:
-			ayumi_set_pan(a->impl, channel, msg[2] / 128.0, 0);
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_PAN, AYUMI_LV2_ALL_CHIPS, channel, msg[2]);
 			break;
 		case LV2_MIDI_CTL_MSB_MAIN_VOLUME:
-			ayumi_set_volume(a->impl, channel, (msg[2] > 119 ? 119 : msg[2]) / 8); // FIXME: max is 14?? 15 doesn't work
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_VOLUME, AYUMI_LV2_ALL_CHIPS, channel, (msg[2] > 119 ? 119 : msg[2]) / 8); // FIXME: max is 14?? 15 doesn't work
 			break;
 		case AYUMI_LV2_MIDI_CC_ENVELOPE_H:
 			a->envelope = (a->envelope & 0x3FFF) + (msg[2] << 14);
-			ayumi_set_envelope(a->impl, a->envelope);
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_ENVELOPE, AYUMI_LV2_ALL_CHIPS, 0, a->envelope);
 			break;
 		case AYUMI_LV2_MIDI_CC_ENVELOPE_M:
 			a->envelope = (a->envelope & 0xC07F) + (msg[2] << 7);
-			ayumi_set_envelope(a->impl, a->envelope);
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_ENVELOPE, AYUMI_LV2_ALL_CHIPS, 0, a->envelope);
 			break;
 		case AYUMI_LV2_MIDI_CC_ENVELOPE_L:
 			a->envelope = (a->envelope & 0xFF80) + msg[2];
-			ayumi_set_envelope(a->impl, a->envelope);
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_ENVELOPE, AYUMI_LV2_ALL_CHIPS, 0, a->envelope);
 			break;
 		case AYUMI_LV2_MIDI_CC_ENVELOPE_SHAPE:
-			ayumi_set_envelope_shape(a->impl, msg[2] & 0xF);
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_ENVELOPE_SHAPE, AYUMI_LV2_ALL_CHIPS, 0, msg[2] & 0xF);
 			break;
 		case AYUMI_LV2_MIDI_CC_DC:
-			ayumi_remove_dc(a->impl);
+			ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_REMOVE_DC, AYUMI_LV2_ALL_CHIPS, 0, 0);
 			break;
 		}
 		break;
 	case LV2_MIDI_MSG_BENDER:
-		a->pitchbend = (msg[1] << 7) + msg[2];
+		// LSB first, 8192 is the center
+		a->pitchbend[channel] = (((msg[2] << 7) | msg[1]) - 8192) * AYUMI_LV2_BEND_RANGE * AYUMI_LV2_BEND_STEPS / 8192;
+		for (int c = 0; c < a->chip_count; c++)
+			if (a->voices[c][channel].key >= 0)
+				ayumi_lv2_queue(a, frame, AYUMI_LV2_WRITE_PERIOD, c, channel, ayumi_lv2_period(a, channel, a->voices[c][channel].key));
 		break;
 	default:
 		break;
 	}
 }
 
+void ayumi_lv2_set_chip_count(AyumiLV2Handle* a) {
+	float* port = a->ports[AYUMI_LV2_CHIPS];
+	int count = port ? (int) *port : 1;
+	count = count < 1 ? 1 : count > AYUMI_LV2_MAX_CHIPS ? AYUMI_LV2_MAX_CHIPS : count;
+	if (count != a->chip_count)
+		ayumi_lv2_trace(a, AYUMI_TRACE_CHIPS, 0, 0, 0, count);
+	// voices left on chips that are no longer rendered would never be released
+	for (int c = count; c < a->chip_count; c++) {
+		for (int i = 0; i < 3; i++) {
+			if (a->voices[c][i].key >= 0) {
+				ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_MIXER, c, i, 3);
+				ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_NOTE_OFF, c, i, 0);
+				a->voices[c][i].key = -1;
+			}
+		}
+	}
+	a->chip_count = count;
+}
+
+/*
+ * The pool threads are only started once an instance renders enough chips
+ * to use them, by the worker, so a session of single chip instances holds
+ * no idle threads. All instances share them. Until the pool is there the
+ * chips render in turn.
+ */
+void ayumi_lv2_set_pool(AyumiLV2Handle* a) {
+	if (a->pool || a->chip_count < AYUMI_LV2_POOL_MIN_CHIPS)
+		return;
+	a->pool = atomic_load_explicit(&a->pool_created, memory_order_acquire);
+	if (a->pool || a->pool_requested || !a->schedule)
+		return;
+	uint32_t message = AYUMI_LV2_WORK_POOL;
+	a->pool_requested = a->schedule->schedule_work(a->schedule->handle, sizeof(message), &message) == LV2_WORKER_SUCCESS;
+}
+
+void ayumi_lv2_set_engine(AyumiLV2Handle* a) {
+	float* port = a->ports[AYUMI_LV2_ENGINE];
+	int engine = port ? (int) *port : AYUMI_ENGINE_FIR;
+	if (engine == a->engine)
+		return;
+	a->engine = engine;
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++)
+		ayumi_set_engine(a->impl[c], engine);
+	ayumi_lv2_trace(a, AYUMI_TRACE_ENGINE, AYUMI_LV2_ALL_CHIPS, 0, 0, engine);
+}
+
+void ayumi_lv2_set_quality(AyumiLV2Handle* a) {
+	float* port = a->ports[AYUMI_LV2_QUALITY];
+	int quality = port ? (int) *port : AYUMI_QUALITY_STANDARD;
+	if (quality == a->quality)
+		return;
+	a->quality = quality; // what was asked for, the chips may fall back to another tier
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++)
+		ayumi_set_quality(a->impl[c], quality);
+	ayumi_lv2_trace(a, AYUMI_TRACE_QUALITY, AYUMI_LV2_ALL_CHIPS, 0, 0, quality);
+}
+
+/*
+ * Chip type and clock are switched in place, without resetting the chips,
+ * and the notes that sound are retuned to the new clock.
+ */
+void ayumi_lv2_set_chip_type(AyumiLV2Handle* a) {
+	float* type_port = a->ports[AYUMI_LV2_CHIP_TYPE];
+	float* clock_port = a->ports[AYUMI_LV2_CLOCK];
+	int is_ym = type_port ? *type_port != 0 : 1;
+	double clock_rate = clock_port ? *clock_port : AYUMI_LV2_CLOCK_RATE;
+	clock_rate = clock_rate < AYUMI_LV2_CLOCK_MIN ? AYUMI_LV2_CLOCK_MIN
+		: clock_rate > AYUMI_LV2_CLOCK_MAX ? AYUMI_LV2_CLOCK_MAX : clock_rate;
+	if (is_ym == a->is_ym && clock_rate == a->clock_rate)
+		return;
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++)
+		ayumi_reconfigure(a->impl[c], is_ym, clock_rate, (int) a->sample_rate / a->render_factor);
+	ayumi_lv2_trace_real(a, AYUMI_TRACE_RECONFIGURE, AYUMI_LV2_ALL_CHIPS, 0, is_ym, clock_rate);
+	a->is_ym = is_ym;
+	if (clock_rate == a->clock_rate)
+		return;
+	a->clock_rate = clock_rate;
+	ayumi_lv2_build_periods(a, clock_rate);
+	for (int c = 0; c < a->chip_count; c++)
+		for (int i = 0; i < 3; i++)
+			if (a->voices[c][i].key >= 0)
+				ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_PERIOD, c, i, ayumi_lv2_period(a, i, a->voices[c][i].key));
+}
+
+/*
+ * Above twice AYUMI_LV2_RENDER_RATE_MIN the chips can render at the host
+ * rate divided by a whole factor and be upsampled, so an instance costs
+ * about the same at 96 or 192 kHz as at 48 kHz. The upsampler starts from
+ * the last output, so a held level does not click when it is switched on.
+ */
+void ayumi_lv2_set_render_rate(AyumiLV2Handle* a) {
+	float* port = a->ports[AYUMI_LV2_RENDER_RATE];
+	int factor = port && *port != 0 ? a->upsampler.factor : 1;
+	if (factor == a->render_factor)
+		return;
+	a->render_factor = factor;
+	ayumi_upsample_reset(&a->upsampler, a->last);
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++)
+		ayumi_reconfigure(a->impl[c], a->is_ym, a->clock_rate, (int) a->sample_rate / factor);
+	ayumi_lv2_trace(a, AYUMI_TRACE_UPSAMPLE, AYUMI_LV2_ALL_CHIPS, 0, 0, factor);
+	ayumi_lv2_trace_real(a, AYUMI_TRACE_RECONFIGURE, AYUMI_LV2_ALL_CHIPS, 0, a->is_ym, a->clock_rate);
+}
+
+/*
+ * Host frames the output lags the MIDI input by: half the upsampler taps
+ * at a capped render rate, and half the BLEP taps with that engine, both
+ * counted in rendered frames.
+ */
+void ayumi_lv2_set_latency(AyumiLV2Handle* a) {
+	float* port = a->ports[AYUMI_LV2_LATENCY];
+	if (!port)
+		return;
+	int frames = a->engine == AYUMI_ENGINE_BLEP ? BLEP_TAPS / 2 : 0;
+	if (a->render_factor > 1)
+		frames += AYUMI_UPSAMPLE_TAPS / 2;
+	*port = (float) (frames * a->render_factor);
+}
+
+/*
+ * Register ports hold a register value, or -1 to leave it to MIDI. Only
+ * the ports that moved since the last run are applied, at its first
+ * frame, so automation costs a compare per port and a write per change
+ * instead of a stream of events. Per channel ports set that PSG channel
+ * of every chip. Ports and MIDI write the same registers and the last
+ * change wins, but the mixer and envelope ports also become what MIDI
+ * builds on, as after a bank change or the envelope CCs.
+ */
+void ayumi_lv2_set_registers(AyumiLV2Handle* a) {
+	uint32_t dirty = 0;
+	for (int i = 0; i < AYUMI_LV2_REGISTER_PORT_COUNT; i++) {
+		float* port = a->ports[AYUMI_LV2_REGISTER_PORTS + i];
+		if (!port || *port == a->registers[i])
+			continue;
+		a->registers[i] = *port;
+		if (*port >= 0)
+			dirty |= 1u << i;
+	}
+	for (int i = 0; dirty; i++, dirty >>= 1) {
+		if (!(dirty & 1))
+			continue;
+		int port = AYUMI_LV2_REGISTER_PORTS + i;
+		int channel = i % 3;
+		float value = a->registers[i];
+		int v = value > 65535 ? 65535 : (int) value;
+		if (port < AYUMI_LV2_PAN) {
+			ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_VOLUME, AYUMI_LV2_ALL_CHIPS, channel, v > 15 ? 15 : v);
+		} else if (port < AYUMI_LV2_MIXER) {
+			ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_PAN, AYUMI_LV2_ALL_CHIPS, channel, value > 1 ? 128 : (uint32_t) (value * 128 + 0.5f));
+		} else if (port < AYUMI_LV2_TONE) {
+			a->mixer[channel] = (v & 7) << 5; // what note ons apply
+			ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_MIXER, AYUMI_LV2_ALL_CHIPS, channel, v & 7);
+		} else if (port < AYUMI_LV2_NOISE) {
+			v = v < 1 ? 1 : v > 4095 ? 4095 : v;
+			ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_PERIOD, AYUMI_LV2_ALL_CHIPS, channel, (uint32_t) v << 8);
+		} else if (port == AYUMI_LV2_NOISE) {
+			ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_NOISE, AYUMI_LV2_ALL_CHIPS, 0, v > 31 ? 31 : v);
+		} else if (port == AYUMI_LV2_ENVELOPE) {
+			a->envelope = v; // the envelope CCs change its bits from here
+			ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_ENVELOPE, AYUMI_LV2_ALL_CHIPS, 0, v);
+		} else {
+			ayumi_lv2_queue(a, 0, AYUMI_LV2_WRITE_ENVELOPE_SHAPE, AYUMI_LV2_ALL_CHIPS, 0, v > 15 ? 15 : v);
+		}
+	}
+}
+
+#ifdef AYUMI_STATS
+double ayumi_lv2_now(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+void ayumi_lv2_stats_begin(AyumiLV2Handle* a) {
+	a->events = 0;
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++)
+		memset(&a->impl[c]->stats, 0, sizeof(struct ayumi_stats));
+}
+
+void ayumi_lv2_set_stat(AyumiLV2Handle* a, int port, double value) {
+	if (a->ports[port])
+		*a->ports[port] = (float) value;
+}
+
+/*
+ * Cycles and ticks are averaged over the frames of every chip, so they
+ * stay comparable when the chip count changes.
+ */
+void ayumi_lv2_stats_end(AyumiLV2Handle* a, double start) {
+	struct ayumi_stats total = { 0 };
+	for (int c = 0; c < a->chip_count; c++) {
+		const struct ayumi_stats* s = &a->impl[c]->stats;
+		total.tick_cycles += s->tick_cycles;
+		total.interpolate_cycles += s->interpolate_cycles;
+		total.decimate_cycles += s->decimate_cycles;
+		total.dc_cycles += s->dc_cycles;
+		total.ticks += s->ticks;
+		total.frames += s->frames;
+	}
+	double frames = total.frames ? (double) total.frames : 1;
+	ayumi_lv2_set_stat(a, AYUMI_LV2_STATS_TICK, total.tick_cycles / frames);
+	ayumi_lv2_set_stat(a, AYUMI_LV2_STATS_INTERPOLATE, total.interpolate_cycles / frames);
+	ayumi_lv2_set_stat(a, AYUMI_LV2_STATS_DECIMATE, total.decimate_cycles / frames);
+	ayumi_lv2_set_stat(a, AYUMI_LV2_STATS_DC, total.dc_cycles / frames);
+	ayumi_lv2_set_stat(a, AYUMI_LV2_STATS_EVENTS, a->events);
+	ayumi_lv2_set_stat(a, AYUMI_LV2_STATS_TICKS, total.ticks / frames);
+	double elapsed = ayumi_lv2_now() - start;
+	if (elapsed > a->worst_run)
+		a->worst_run = elapsed;
+	ayumi_lv2_set_stat(a, AYUMI_LV2_STATS_WORST_RUN, a->worst_run);
+}
+#endif
+
 void ayumi_lv2_run(LV2_Handle instance, uint32_t sample_count) {
 	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
 	if (!a->active)
 		return;
 
-	LV2_Atom_Sequence* seq = (LV2_Atom_Sequence*) a->ports[AYUMI_LV2_ATOM_INPUT_PORT];
+#ifdef AYUMI_STATS
+	double start = ayumi_lv2_now();
+	ayumi_lv2_stats_begin(a);
+#endif
+	a->frame = 0;
+	ayumi_lv2_set_chip_count(a);
+	ayumi_lv2_set_pool(a);
+	ayumi_lv2_set_quality(a);
+	ayumi_lv2_set_engine(a);
+	ayumi_lv2_set_chip_type(a);
+	ayumi_lv2_set_render_rate(a);
+	ayumi_lv2_set_latency(a);
+	ayumi_lv2_set_registers(a);
 
-	int currentFrame = 0;
+	LV2_Atom_Sequence* seq = (LV2_Atom_Sequence*) a->ports[AYUMI_LV2_ATOM_INPUT_PORT];
 
 	LV2_ATOM_SEQUENCE_FOREACH(seq, ev) {
-		if (ev->time.frames != 0) {
-			int max = currentFrame + ev->time.frames;
-			max = max < sample_count ? max : sample_count;
-			for (int i = currentFrame; i < max; i++) {
-				ayumi_process(a->impl);
-				ayumi_remove_dc(a->impl);
-				a->ports[AYUMI_LV2_AUDIO_OUT_LEFT][i] = (float) a->impl->left;
-				a->ports[AYUMI_LV2_AUDIO_OUT_RIGHT][i] = (float) a->impl->right;
-			}
-			currentFrame = max;
-		}
 		if (ev->body.type == a->midi_event_uri) {
-			ayumi_lv2_process_midi_event(a, ev);
+			// event times are frames from the start of this run
+			uint32_t frame = ev->time.frames < sample_count ? (uint32_t) ev->time.frames : sample_count;
+			ayumi_lv2_process_midi_event(a, ev, frame);
+#ifdef AYUMI_STATS
+			a->events++;
+#endif
 		}
 	}
 
-	for (int i = currentFrame; i < sample_count; i++) {
-		ayumi_process(a->impl);
-		ayumi_remove_dc(a->impl);
-		a->ports[AYUMI_LV2_AUDIO_OUT_LEFT][i] = (float) a->impl->left;
-		a->ports[AYUMI_LV2_AUDIO_OUT_RIGHT][i] = (float) a->impl->right;
-	}
+	ayumi_lv2_flush(a, sample_count);
+	ayumi_lv2_publish_state(a);
+	if (a->trace)
+		ayumi_lv2_trace_schedule(a);
+#ifdef AYUMI_STATS
+	ayumi_lv2_stats_end(a, start);
+#endif
 }
 
 void ayumi_lv2_deactivate(LV2_Handle instance) {
 	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
 	a->active = false;
+	if (!a->trace)
+		return;
+	// with a worker the drain waits for cleanup, so the ring keeps one reader
+	if (!a->schedule)
+		ayumi_lv2_trace_drain(a);
+	ayumi_lv2_trace(a, AYUMI_TRACE_STOP, 0, 0, 0, 0);
+	if (!a->schedule)
+		ayumi_lv2_trace_drain(a);
 }
 
 void ayumi_lv2_cleanup(LV2_Handle instance) {
 	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
 	free((void*) a->bundle_path);
-	free(a->impl);
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++) {
+		free(a->impl[c]);
+		free(a->stems[c]);
+	}
+	ayumi_pool_release(atomic_load_explicit(&a->pool_created, memory_order_acquire));
+	if (a->trace) {
+		// the stop goes in once there is room, with the count of lost records
+		ayumi_lv2_trace_drain(a);
+		ayumi_lv2_trace(a, AYUMI_TRACE_STOP, 0, 0, 0, 0);
+		ayumi_lv2_trace_drain(a);
+		fclose(a->trace_file);
+		ayumi_trace_destroy(a->trace);
+	}
 	free(a);
 }
 
+// the worker drains the trace and joins the chip pool
+LV2_Worker_Status ayumi_lv2_work(
+		LV2_Handle instance,
+		LV2_Worker_Respond_Function respond,
+		LV2_Worker_Respond_Handle handle,
+		uint32_t size,
+		const void * data) {
+	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
+	if (size == sizeof(uint32_t) && *(const uint32_t*) data == AYUMI_LV2_WORK_POOL) {
+		atomic_store_explicit(&a->pool_created, ayumi_lv2_create_pool(), memory_order_release);
+		return LV2_WORKER_SUCCESS;
+	}
+	if (a->trace) {
+		ayumi_lv2_trace_drain(a);
+		atomic_store_explicit(&a->trace_scheduled, 0, memory_order_release);
+	}
+	return LV2_WORKER_SUCCESS;
+}
+
+LV2_Worker_Status ayumi_lv2_work_response(LV2_Handle instance, uint32_t size, const void * data) {
+	return LV2_WORKER_SUCCESS;
+}
+
+static const LV2_Worker_Interface ayumi_lv2_worker = {
+	ayumi_lv2_work,
+	ayumi_lv2_work_response,
+	NULL
+};
+
+LV2_State_Status ayumi_lv2_save(
+		LV2_Handle instance,
+		LV2_State_Store_Function store,
+		LV2_State_Handle handle,
+		uint32_t flags,
+		const LV2_Feature *const * features) {
+	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
+	AyumiLV2State s;
+	uint8_t data[sizeof(AyumiLV2State) + 16]; // the encoding is never longer
+	AyumiLV2Blob b = { data, sizeof(data), 0, false };
+	ayumi_lv2_read_state(a, &s);
+	ayumi_lv2_encode_state(&s, &b);
+	if (b.overflow)
+		return LV2_STATE_ERR_NO_SPACE;
+	return store(handle, a->state_uri, data, b.offset, a->chunk_uri, LV2_STATE_IS_POD | LV2_STATE_IS_PORTABLE);
+}
+
+/*
+ * Not called while run() plays, so the chips are loaded in place. Their
+ * filters are filled with the restored levels and the queue of pending
+ * writes is dropped, so playback resumes from the state without a click.
+ */
+LV2_State_Status ayumi_lv2_restore(
+		LV2_Handle instance,
+		LV2_State_Retrieve_Function retrieve,
+		LV2_State_Handle handle,
+		uint32_t flags,
+		const LV2_Feature *const * features) {
+	AyumiLV2Handle* a = (AyumiLV2Handle*) instance;
+	size_t size;
+	uint32_t type, value_flags;
+	const void* data = retrieve(handle, a->state_uri, &size, &type, &value_flags);
+	if (!data)
+		return LV2_STATE_ERR_NO_PROPERTY;
+	if (type != a->chunk_uri)
+		return LV2_STATE_ERR_BAD_TYPE;
+	AyumiLV2State s;
+	AyumiLV2Blob b = { (uint8_t*) data, size, 0, false };
+	if (!ayumi_lv2_decode_state(&s, &b))
+		return LV2_STATE_ERR_UNKNOWN;
+	memcpy(a->mixer, s.mixer, sizeof(a->mixer));
+	a->envelope = s.envelope;
+	memcpy(a->pitchbend, s.pitchbend, sizeof(a->pitchbend));
+	a->voice_age = s.voice_age;
+	memcpy(a->voices, s.voices, sizeof(a->voices));
+	memcpy(a->tones, s.tones, sizeof(a->tones));
+	for (int c = 0; c < AYUMI_LV2_MAX_CHIPS; c++) {
+		ayumi_load_state(a->impl[c], &s.chips[c]);
+		if (a->stems[c])
+			ayumi_stems_settle(a->stems[c], a->impl[c]);
+		ayumi_lv2_trace_state(a, c, &s.chips[c]);
+	}
+	memcpy(a->shadow, s.shadow, sizeof(a->shadow));
+	a->queue_length = 0;
+	ayumi_lv2_publish_state(a);
+	return LV2_STATE_SUCCESS;
+}
+
+static const LV2_State_Interface ayumi_lv2_state = {
+	ayumi_lv2_save,
+	ayumi_lv2_restore
+};
+
 const void * ayumi_lv2_extension_data(const char * uri) {
+	if (!strcmp(uri, LV2_WORKER__interface))
+		return &ayumi_lv2_worker;
+	if (!strcmp(uri, LV2_STATE__interface))
+		return &ayumi_lv2_state;
 	return NULL;
 }
 
@@ -232,8 +1291,27 @@ const LV2_Descriptor ayumi_lv2 = {
 	ayumi_lv2_extension_data
 };
 
+// the same plugin with an output per PSG channel, see ayumi_lv2_process()
+const LV2_Descriptor ayumi_lv2_stems = {
+	AYUMI_LV2_STEMS_URI,
+	ayumi_lv2_instantiate,
+	ayumi_lv2_connect_port,
+	ayumi_lv2_activate,
+	ayumi_lv2_run,
+	ayumi_lv2_deactivate,
+	ayumi_lv2_cleanup,
+	ayumi_lv2_extension_data
+};
+
 const LV2_Descriptor * lv2_descriptor(uint32_t index)
 {
-	return &ayumi_lv2;
+	switch (index) {
+	case 0:
+		return &ayumi_lv2;
+	case 1:
+		return &ayumi_lv2_stems;
+	default:
+		return NULL;
+	}
 }
 
@@ -3,6 +3,7 @@
 #include <string.h>
 #include <math.h>
 #include "ayumi.h"
+#include "ayumi_internal.h"
 
 static const double AY_dac_table[] = {
   0.0, 0.0,
@@ -42,119 +43,431 @@ static const double YM_dac_table[] = {
   0.879926756695, 1.0
 };
 
-static void reset_segment(struct ayumi* ay);
-
-static int update_tone(struct ayumi* ay, int index) {
-  struct tone_channel* ch = &ay->channels[index];
-  ch->tone_counter += 1;
-  if (ch->tone_counter >= ch->tone_period) {
-    ch->tone_counter = 0;
-    ch->tone ^= 1;
-  }
-  return ch->tone;
+const double* ayumi_dac_table(int is_ym) {
+  return is_ym ? YM_dac_table : AY_dac_table;
 }
 
-static int update_noise(struct ayumi* ay) {
-  int bit0x3;
-  ay->noise_counter += 1;
-  if (ay->noise_counter >= (ay->noise_period << 1)) {
-    ay->noise_counter = 0;
-    bit0x3 = ((ay->noise ^ (ay->noise >> 3)) & 1);
-    ay->noise = (ay->noise >> 1) | (bit0x3 << 16);
-  }
-  return ay->noise & 1;
+/*
+ * Envelope level of every shape over its two segments of 32 steps. The
+ * second segment either repeats, then the envelope runs through all 64
+ * steps in a loop, or holds, then it stays on step 32.
+ */
+#define UP 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, \
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31
+#define DOWN 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, \
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+#define TOP 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, \
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31
+#define BOTTOM 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, \
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+
+static const unsigned char Envelope_levels[16][64] = {
+  {DOWN, BOTTOM},
+  {DOWN, BOTTOM},
+  {DOWN, BOTTOM},
+  {DOWN, BOTTOM},
+  {UP, BOTTOM},
+  {UP, BOTTOM},
+  {UP, BOTTOM},
+  {UP, BOTTOM},
+  {DOWN, DOWN},
+  {DOWN, BOTTOM},
+  {DOWN, UP},
+  {DOWN, TOP},
+  {UP, UP},
+  {UP, TOP},
+  {UP, DOWN},
+  {UP, BOTTOM}
+};
+
+static const int Envelope_holds[16] = {1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1};
+
+#undef UP
+#undef DOWN
+#undef TOP
+#undef BOTTOM
+
+/* Length of the noise sequence, ay->noise is a position in it */
+#define NOISE_SEQUENCE 131071
+
+static const uint32_t Noise_bits[(NOISE_SEQUENCE + 31) / 32] = {
+#include "ayumi_noise_bits.h"
+};
+
+/* DAC table index of a channel, 0 while its tone or noise gate is low */
+static inline int channel_out(const struct tone_channel* ch, int noise, int envelope) {
+  int out = -((ch->tone | ch->t_off) & (noise | ch->n_off));
+  return out & ((envelope & -(ch->e_on != 0)) | ((ch->volume * 2 + 1) & -(ch->e_on == 0)));
 }
 
-static void slide_up(struct ayumi* ay) {
-  ay->envelope += 1;
-  if (ay->envelope > 31) {
-    ay->envelope_segment ^= 1;
-    reset_segment(ay);
-  }
+static inline int noise_bit(struct ayumi* ay) {
+  return (Noise_bits[ay->noise >> 5] >> (ay->noise & 31)) & 1;
 }
 
-static void slide_down(struct ayumi* ay) {
-  ay->envelope -= 1;
-  if (ay->envelope < 0) {
-    ay->envelope_segment ^= 1;
-    reset_segment(ay);
+/*
+ * One tick of every counter and the mixer output, without branches: a
+ * counter that reaches its period gives an all ones mask, which clears
+ * it and toggles or steps what it drives.
+ */
+static void mix(struct ayumi* ay) {
+  int i;
+  int wrap;
+  int noise;
+  int envelope;
+  int out;
+  double left = 0;
+  double right = 0;
+  struct tone_channel* ch;
+  ay->noise_counter += 1;
+  wrap = -(ay->noise_counter >= (ay->noise_period << 1));
+  ay->noise_counter &= ~wrap;
+  ay->noise += wrap & 1;
+  ay->noise -= NOISE_SEQUENCE & -(ay->noise == NOISE_SEQUENCE);
+  noise = noise_bit(ay);
+  ay->envelope_counter += 1;
+  wrap = -(ay->envelope_counter >= ay->envelope_period);
+  ay->envelope_counter &= ~wrap;
+  ay->envelope_step += wrap & ((Envelope_holds[ay->envelope_shape] & (ay->envelope_step >> 5)) ^ 1);
+  ay->envelope_step &= 63;
+  ay->envelope = Envelope_levels[ay->envelope_shape][ay->envelope_step];
+  envelope = ay->envelope;
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ch = &ay->channels[i];
+    ch->tone_counter += 1;
+    wrap = -(ch->tone_counter >= ch->tone_period);
+    ch->tone_counter &= ~wrap;
+    ch->tone ^= wrap & 1;
+    out = channel_out(ch, noise, envelope);
+    left += ay->dac_table[out] * ch->pan_left;
+    right += ay->dac_table[out] * ch->pan_right;
   }
+  ay->mixer_left = left;
+  ay->mixer_right = right;
 }
 
-static void hold_top(struct ayumi* ay) {
-  (void) ay;
+static int is_sliding(struct ayumi* ay) {
+  return !(Envelope_holds[ay->envelope_shape] & (ay->envelope_step >> 5));
 }
 
-static void hold_bottom(struct ayumi* ay) {
-  (void) ay;
+/* Ticks to update a counter, returns how many times it wrapped */
+static int count_wraps(int* counter, int period, int ticks) {
+  int first = period - *counter < 1 ? 1 : period - *counter;
+  if (ticks < first) {
+    *counter += ticks;
+    return 0;
+  }
+  ticks -= first;
+  period = period < 1 ? 1 : period;
+  *counter = ticks % period;
+  return 1 + ticks / period;
 }
 
-static void (* const Envelopes[][2])(struct ayumi*) = {
-  {slide_down, hold_bottom},
-  {slide_down, hold_bottom},
-  {slide_down, hold_bottom},
-  {slide_down, hold_bottom},
-  {slide_up, hold_bottom},
-  {slide_up, hold_bottom},
-  {slide_up, hold_bottom},
-  {slide_up, hold_bottom},
-  {slide_down, slide_down},
-  {slide_down, hold_bottom},
-  {slide_down, slide_up},
-  {slide_down, hold_top},
-  {slide_up, slide_up},
-  {slide_up, hold_top},
-  {slide_up, slide_down},
-  {slide_up, hold_bottom}
-};
-
-static void reset_segment(struct ayumi* ay) {
-  if (Envelopes[ay->envelope_shape][ay->envelope_segment] == slide_down
-    || Envelopes[ay->envelope_shape][ay->envelope_segment] == hold_top) {
-    ay->envelope = 31;
+/* The level tables let the envelope and the noise take any number of steps at once */
+static void step_envelope(struct ayumi* ay, int steps) {
+  if (steps == 0 || !is_sliding(ay)) {
     return;
   }
-  ay->envelope = 0;
+  if (Envelope_holds[ay->envelope_shape]) {
+    ay->envelope_step = ay->envelope_step + steps < 32 ? ay->envelope_step + steps : 32;
+  } else {
+    ay->envelope_step = (ay->envelope_step + steps) & 63;
+  }
+  ay->envelope = Envelope_levels[ay->envelope_shape][ay->envelope_step];
 }
 
-int update_envelope(struct ayumi* ay) {
-  ay->envelope_counter += 1;
-  if (ay->envelope_counter >= ay->envelope_period) {
-    ay->envelope_counter = 0;
-    Envelopes[ay->envelope_shape][ay->envelope_segment](ay);
+static void step_noise(struct ayumi* ay, int steps) {
+  ay->noise = (ay->noise + steps % NOISE_SEQUENCE) % NOISE_SEQUENCE;
+}
+
+/*
+ * Number of ticks up to and including the next one that toggles a counter
+ * the output depends on. Tones that are off, and the noise and envelope
+ * when no channel uses them, are left to sync_counters().
+ */
+static int next_event(struct ayumi* ay) {
+  int i;
+  int ticks = 0x10000;
+  int noise = 0;
+  int envelope = 0;
+  struct tone_channel* ch;
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ch = &ay->channels[i];
+    if (!ch->t_off && ch->tone_period - ch->tone_counter < ticks) {
+      ticks = ch->tone_period - ch->tone_counter;
+    }
+    noise |= !ch->n_off;
+    envelope |= ch->e_on;
+  }
+  if (noise && (ay->noise_period << 1) - ay->noise_counter < ticks) {
+    ticks = (ay->noise_period << 1) - ay->noise_counter;
   }
-  return ay->envelope;
+  if (envelope && is_sliding(ay) && ay->envelope_period - ay->envelope_counter < ticks) {
+    ticks = ay->envelope_period - ay->envelope_counter;
+  }
+  return ticks < 1 ? 1 : ticks;
 }
 
-static void update_mixer(struct ayumi* ay) {
+/*
+ * Adds the skipped ticks to the counters. The ones next_event() waits for
+ * did not reach their period, the others may have wrapped any number of
+ * times.
+ */
+static void sync_counters(struct ayumi* ay) {
   int i;
-  int out;
-  int noise = update_noise(ay);
-  int envelope = update_envelope(ay);
-  ay->left = 0;
-  ay->right = 0;
+  struct tone_channel* ch;
+  ay->skip = 0;
+  if (ay->pending == 0) {
+    return;
+  }
   for (i = 0; i < TONE_CHANNELS; i += 1) {
-    out = (update_tone(ay, i) | ay->channels[i].t_off) & (noise | ay->channels[i].n_off);
-    out *= ay->channels[i].e_on ? envelope : ay->channels[i].volume * 2 + 1;
-    ay->left += ay->dac_table[out] * ay->channels[i].pan_left;
-    ay->right += ay->dac_table[out] * ay->channels[i].pan_right;
+    ch = &ay->channels[i];
+    ch->tone ^= count_wraps(&ch->tone_counter, ch->tone_period, ay->pending) & 1;
   }
+  step_noise(ay, count_wraps(&ay->noise_counter, ay->noise_period << 1, ay->pending));
+  step_envelope(ay, count_wraps(&ay->envelope_counter, ay->envelope_period, ay->pending));
+  ay->pending = 0;
+}
+
+/*
+ * Between two counter toggles the mixer output is constant, so the ticks
+ * in between only count down. Returns 0 if the output is unchanged.
+ */
+static int update_mixer(struct ayumi* ay) {
+  if (ay->skip > 0) {
+    ay->skip -= 1;
+    ay->pending += 1;
+    return 0;
+  }
+  sync_counters(ay);
+  mix(ay);
+  ay->skip = next_event(ay) - 1;
+  return 1;
 }
 
 int ayumi_configure(struct ayumi* ay, int is_ym, double clock_rate, int sr) {
   int i;
   memset(ay, 0, sizeof(struct ayumi));
-  ay->step = clock_rate / (sr * 8 * DECIMATE_FACTOR);
-  ay->dac_table = is_ym ? YM_dac_table : AY_dac_table;
-  ay->noise = 1;
+  ay->envelope_step = 32; /* level 0 until a shape is set, as if shape 0 had run down */
+  ay->quality = AYUMI_QUALITY_STANDARD;
+  ayumi_set_simd(ay, AYUMI_SIMD_AUTO);
   ayumi_set_envelope(ay, 1);
   for (i = 0; i < TONE_CHANNELS; i += 1) {
     ayumi_set_tone(ay, i, 1);
   }
+  return ayumi_reconfigure(ay, is_ym, clock_rate, sr);
+}
+
+static const int Decimate_factors[] = {DECIMATE_FACTOR_DRAFT, DECIMATE_FACTOR, DECIMATE_FACTOR_HIGH};
+static const int Fir_sizes[] = {FIR_SIZE_DRAFT, FIR_SIZE, FIR_SIZE_HIGH};
+
+#define TAP(x) SAMPLE(x)
+static const ayumi_sample Blep_taps[BLEP_PHASES + 1][BLEP_TAPS] __attribute__((aligned(64))) = {
+#include "ayumi_blep_taps.h"
+};
+#undef TAP
+
+/*
+ * Switches chip type and clock while playing. Registers, counters and
+ * filter history are kept, the next tick mixes with the new DAC table.
+ */
+int ayumi_reconfigure(struct ayumi* ay, int is_ym, double clock_rate, int sr) {
+  sync_counters(ay);
+  ay->frame_ticks = clock_rate / (sr * 8);
+  ay->step = ay->frame_ticks / Decimate_factors[ay->quality];
+  ay->dac_table = ayumi_dac_table(is_ym);
   return ay->step < 1;
 }
 
+/*
+ * Pans that all share one left/right ratio make both outputs one signal
+ * times two gains. The FIR engine then runs a single interpolator and FIR
+ * on the sum of the mixer outputs and scales the result, which halves
+ * the decimation. The mono history is kept in the stereo one: newest
+ * first from the start, and oldest first from halfway for the folded taps.
+ */
+#define MONO_FORWARD(ay) (&(ay)->fir[0][0])
+#define MONO_REVERSED(ay) (&(ay)->fir[AYUMI_FIR_MAX][0])
+
+/* Silent pans are left out, they add nothing to either output */
+static int is_mono(struct ayumi* ay, double* left, double* right) {
+  int i;
+  double l = 0;
+  double r = 0;
+  struct tone_channel* ch;
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ch = &ay->channels[i];
+    if (ch->pan_left == 0 && ch->pan_right == 0) {
+      continue;
+    }
+    if (ch->pan_left + ch->pan_right == 0) {
+      return 0;
+    }
+    if (l == 0 && r == 0) {
+      l = ch->pan_left;
+      r = ch->pan_right;
+    } else if (ch->pan_left * r != ch->pan_right * l) {
+      return 0;
+    }
+  }
+  if (ay->engine != AYUMI_ENGINE_FIR || (l == 0 && r == 0)) {
+    return 0;
+  }
+  *left = l / (l + r);
+  *right = r / (l + r);
+  return 1;
+}
+
+/* Backwards, so that each mono sample is read before its lanes overwrite it */
+static void to_stereo(struct ayumi* ay) {
+  int i;
+  ayumi_sample y;
+  ayumi_sample* forward = MONO_FORWARD(ay);
+  ayumi_sample l = SAMPLE(ay->mono_left);
+  ayumi_sample r = SAMPLE(ay->mono_right);
+  for (i = 0; i < 4; i += 1) {
+    ay->interpolator_right.c[i] = SAMPLE_MUL(r, ay->interpolator_left.c[i]);
+    ay->interpolator_left.c[i] = SAMPLE_MUL(l, ay->interpolator_left.c[i]);
+    ay->interpolator_right.y[i] = SAMPLE_MUL(r, ay->interpolator_left.y[i]);
+    ay->interpolator_left.y[i] = SAMPLE_MUL(l, ay->interpolator_left.y[i]);
+  }
+  for (i = Fir_sizes[ay->quality] * 2 - 1; i >= 0; i -= 1) {
+    y = forward[i];
+    ay->fir[i][0] = SAMPLE_MUL(l, y);
+    ay->fir[i][1] = SAMPLE_MUL(r, y);
+  }
+}
+
+/*
+ * Forwards, each pair of lanes is read before its sum overwrites it. The
+ * sum is only exact for a history rendered with the current pans.
+ */
+static void to_mono(struct ayumi* ay) {
+  int i;
+  int size = Fir_sizes[ay->quality];
+  ayumi_sample* forward = MONO_FORWARD(ay);
+  ayumi_sample* reversed = MONO_REVERSED(ay);
+  for (i = 0; i < 4; i += 1) {
+    ay->interpolator_left.c[i] += ay->interpolator_right.c[i];
+    ay->interpolator_left.y[i] += ay->interpolator_right.y[i];
+  }
+  for (i = 0; i < size * 2; i += 1) {
+    forward[i] = ay->fir[i][0] + ay->fir[i][1];
+  }
+  ay->mono_index = 0;
+  for (i = 0; i < size; i += 1) {
+    reversed[(size - i) % size] = forward[ay->fir_index + i];
+    reversed[(size - i) % size + size] = forward[ay->fir_index + i];
+  }
+}
+
+/*
+ * With wait, a chip that can go mono first renders in stereo until the
+ * FIR history and the interpolator hold only output of the new pans.
+ */
+static void update_mono(struct ayumi* ay, int wait) {
+  double left = 0;
+  double right = 0;
+  int mono = is_mono(ay, &left, &right);
+  if (mono && ay->mono && left == ay->mono_left && right == ay->mono_right) {
+    return;
+  }
+  if (ay->mono) {
+    to_stereo(ay);
+  }
+  ay->mono = 0;
+  ay->mono_wait = 0;
+  if (mono && wait) {
+    ay->mono_wait = Fir_sizes[ay->quality] / Decimate_factors[ay->quality] + 4;
+    return;
+  }
+  ay->mono = mono;
+  if (mono) {
+    ay->mono_left = left;
+    ay->mono_right = right;
+    to_mono(ay);
+  }
+}
+
+/* Counts the frames rendered in stereo since the pans allowed mono */
+static void wait_mono(struct ayumi* ay, int count) {
+  ay->mono_wait -= count;
+  if (ay->mono_wait <= 0) {
+    update_mono(ay, 0);
+  }
+}
+
+int ayumi_set_simd(struct ayumi* ay, int simd) {
+  ay->simd = ayumi_decimator_select(simd);
+  ay->decimate = ayumi_decimator_get(ay->simd, ay->quality);
+  ay->decimate_mono = ayumi_mono_decimator_get(ay->simd, ay->quality);
+  return ay->simd;
+}
+
+/*
+ * The FIR history of another tier is useless, it is refilled with the
+ * last mixer output so that a held level does not click.
+ */
+int ayumi_set_quality(struct ayumi* ay, int quality) {
+  int i;
+  if (quality < AYUMI_QUALITY_DRAFT || quality > AYUMI_QUALITY_HIGH
+    || (quality == AYUMI_QUALITY_HIGH && AYUMI_FIR_MAX < FIR_SIZE_HIGH)) {
+    quality = AYUMI_QUALITY_STANDARD;
+  }
+  ay->quality = quality;
+  ay->step = ay->frame_ticks / Decimate_factors[quality];
+  ay->decimate = ayumi_decimator_get(ay->simd, quality);
+  ay->decimate_mono = ayumi_mono_decimator_get(ay->simd, quality);
+  if (ay->engine == AYUMI_ENGINE_BLEP) {
+    return quality;
+  }
+  ay->fir_index = 0;
+  ay->mono_index = 0;
+  if (ay->mono_wait > 0) {
+    ay->mono_wait = Fir_sizes[quality] / Decimate_factors[quality] + 4;
+  }
+  /* A mono chip fills both of its rings with its one level */
+  for (i = 0; i < AYUMI_FIR_MAX * 2; i += 1) {
+    ay->fir[i][0] = ay->interpolator_left.y[3];
+    ay->fir[i][1] = ay->mono ? ay->interpolator_left.y[3] : ay->interpolator_right.y[3];
+  }
+  return quality;
+}
+
+/*
+ * Both engines restart from the last mixer output. The BLEP engine keeps
+ * its pending steps in the FIR history, which starts out empty. The FIR
+ * engine goes mono if the pans allow it.
+ */
+int ayumi_set_engine(struct ayumi* ay, int engine) {
+  int i;
+  ayumi_sample l = SAMPLE(ay->mixer_left);
+  ayumi_sample r = SAMPLE(ay->mixer_right);
+  ay->engine = engine == AYUMI_ENGINE_BLEP ? AYUMI_ENGINE_BLEP : AYUMI_ENGINE_FIR;
+  ay->mono = 0;
+  ay->flat = 0;
+  ay->fir_index = 0;
+  for (i = 0; i < 4; i += 1) {
+    ay->interpolator_left.y[i] = l;
+    ay->interpolator_right.y[i] = r;
+  }
+  ay->interpolator_left.c[0] = l;
+  ay->interpolator_left.c[1] = 0;
+  ay->interpolator_left.c[2] = 0;
+  ay->interpolator_right.c[0] = r;
+  ay->interpolator_right.c[1] = 0;
+  ay->interpolator_right.c[2] = 0;
+  ay->blep_left = l;
+  ay->blep_right = r;
+  for (i = 0; i < AYUMI_FIR_MAX * 2; i += 1) {
+    ay->fir[i][0] = ay->engine == AYUMI_ENGINE_FIR ? l : 0;
+    ay->fir[i][1] = ay->engine == AYUMI_ENGINE_FIR ? r : 0;
+  }
+  update_mono(ay, 0);
+  return ay->engine;
+}
+
 void ayumi_set_pan(struct ayumi* ay, int index, double pan, int is_eqp) {
+  sync_counters(ay);
   if (is_eqp) {
     ay->channels[index].pan_left = sqrt(1 - pan);
     ay->channels[index].pan_right = sqrt(pan);
@@ -162,176 +475,887 @@ void ayumi_set_pan(struct ayumi* ay, int index, double pan, int is_eqp) {
     ay->channels[index].pan_left = 1 - pan;
     ay->channels[index].pan_right = pan;
   }
+  update_mono(ay, 1);
 }
 
 void ayumi_set_tone(struct ayumi* ay, int index, int period) {
+  sync_counters(ay);
   period &= 0xfff;
   ay->channels[index].tone_period = (period == 0) | period;
 }
 
 void ayumi_set_noise(struct ayumi* ay, int period) {
+  sync_counters(ay);
   ay->noise_period = period & 0x1f;
 }
 
 void ayumi_set_mixer(struct ayumi* ay, int index, int t_off, int n_off, int e_on) {
+  sync_counters(ay);
   ay->channels[index].t_off = t_off & 1;
   ay->channels[index].n_off = n_off & 1;
   ay->channels[index].e_on = e_on;
 }
 
 void ayumi_set_volume(struct ayumi* ay, int index, int volume) {
+  sync_counters(ay);
   ay->channels[index].volume = volume & 0xf;
 }
 
 void ayumi_set_envelope(struct ayumi* ay, int period) {
+  sync_counters(ay);
   period &= 0xffff;
   ay->envelope_period = (period == 0) | period;
 }
 
 void ayumi_set_envelope_shape(struct ayumi* ay, int shape) {
+  sync_counters(ay);
   ay->envelope_shape = shape & 0xf;
   ay->envelope_counter = 0;
-  ay->envelope_segment = 0;
-  reset_segment(ay);
-}
-
-static double decimate(double* x) {
-  double y = -0.0000046183113992051936 * (x[1] + x[191]) +
-    -0.00001117761640887225 * (x[2] + x[190]) +
-    -0.000018610264502005432 * (x[3] + x[189]) +
-    -0.000025134586135631012 * (x[4] + x[188]) +
-    -0.000028494281690666197 * (x[5] + x[187]) +
-    -0.000026396828793275159 * (x[6] + x[186]) +
-    -0.000017094212558802156 * (x[7] + x[185]) +
-    0.000023798193576966866 * (x[9] + x[183]) +
-    0.000051281160242202183 * (x[10] + x[182]) +
-    0.00007762197826243427 * (x[11] + x[181]) +
-    0.000096759426664120416 * (x[12] + x[180]) +
-    0.00010240229300393402 * (x[13] + x[179]) +
-    0.000089344614218077106 * (x[14] + x[178]) +
-    0.000054875700118949183 * (x[15] + x[177]) +
-    -0.000069839082210680165 * (x[17] + x[175]) +
-    -0.0001447966132360757 * (x[18] + x[174]) +
-    -0.00021158452917708308 * (x[19] + x[173]) +
-    -0.00025535069106550544 * (x[20] + x[172]) +
-    -0.00026228714374322104 * (x[21] + x[171]) +
-    -0.00022258805927027799 * (x[22] + x[170]) +
-    -0.00013323230495695704 * (x[23] + x[169]) +
-    0.00016182578767055206 * (x[25] + x[167]) +
-    0.00032846175385096581 * (x[26] + x[166]) +
-    0.00047045611576184863 * (x[27] + x[165]) +
-    0.00055713851457530944 * (x[28] + x[164]) +
-    0.00056212565121518726 * (x[29] + x[163]) +
-    0.00046901918553962478 * (x[30] + x[162]) +
-    0.00027624866838952986 * (x[31] + x[161]) +
-    -0.00032564179486838622 * (x[33] + x[159]) +
-    -0.00065182310286710388 * (x[34] + x[158]) +
-    -0.00092127787309319298 * (x[35] + x[157]) +
-    -0.0010772534348943575 * (x[36] + x[156]) +
-    -0.0010737727700273478 * (x[37] + x[155]) +
-    -0.00088556645390392634 * (x[38] + x[154]) +
-    -0.00051581896090765534 * (x[39] + x[153]) +
-    0.00059548767193795277 * (x[41] + x[151]) +
-    0.0011803558710661009 * (x[42] + x[150]) +
-    0.0016527320270369871 * (x[43] + x[149]) +
-    0.0019152679330965555 * (x[44] + x[148]) +
-    0.0018927324805381538 * (x[45] + x[147]) +
-    0.0015481870327877937 * (x[46] + x[146]) +
-    0.00089470695834941306 * (x[47] + x[145]) +
-    -0.0010178225878206125 * (x[49] + x[143]) +
-    -0.0020037400552054292 * (x[50] + x[142]) +
-    -0.0027874356824117317 * (x[51] + x[141]) +
-    -0.003210329988021943 * (x[52] + x[140]) +
-    -0.0031540624117984395 * (x[53] + x[139]) +
-    -0.0025657163651900345 * (x[54] + x[138]) +
-    -0.0014750752642111449 * (x[55] + x[137]) +
-    0.0016624165446378462 * (x[57] + x[135]) +
-    0.0032591192839069179 * (x[58] + x[134]) +
-    0.0045165685815867747 * (x[59] + x[133]) +
-    0.0051838984346123896 * (x[60] + x[132]) +
-    0.0050774264697459933 * (x[61] + x[131]) +
-    0.0041192521414141585 * (x[62] + x[130]) +
-    0.0023628575417966491 * (x[63] + x[129]) +
-    -0.0026543507866759182 * (x[65] + x[127]) +
-    -0.0051990251084333425 * (x[66] + x[126]) +
-    -0.0072020238234656924 * (x[67] + x[125]) +
-    -0.0082672928192007358 * (x[68] + x[124]) +
-    -0.0081033739572956287 * (x[69] + x[123]) +
-    -0.006583111539570221 * (x[70] + x[122]) +
-    -0.0037839040415292386 * (x[71] + x[121]) +
-    0.0042781252851152507 * (x[73] + x[119]) +
-    0.0084176358598320178 * (x[74] + x[118]) +
-    0.01172566057463055 * (x[75] + x[117]) +
-    0.013550476647788672 * (x[76] + x[116]) +
-    0.013388189369997496 * (x[77] + x[115]) +
-    0.010979501242341259 * (x[78] + x[114]) +
-    0.006381274941685413 * (x[79] + x[113]) +
-    -0.007421229604153888 * (x[81] + x[111]) +
-    -0.01486456304340213 * (x[82] + x[110]) +
-    -0.021143584622178104 * (x[83] + x[109]) +
-    -0.02504275058758609 * (x[84] + x[108]) +
-    -0.025473530942547201 * (x[85] + x[107]) +
-    -0.021627310017882196 * (x[86] + x[106]) +
-    -0.013104323383225543 * (x[87] + x[105]) +
-    0.017065133989980476 * (x[89] + x[103]) +
-    0.036978919264451952 * (x[90] + x[102]) +
-    0.05823318062093958 * (x[91] + x[101]) +
-    0.079072012081405949 * (x[92] + x[100]) +
-    0.097675998716952317 * (x[93] + x[99]) +
-    0.11236045936950932 * (x[94] + x[98]) +
-    0.12176343577287731 * (x[95] + x[97]) +
-    0.125 * x[96];
-  memcpy(&x[FIR_SIZE - DECIMATE_FACTOR], x, DECIMATE_FACTOR * sizeof(double));
-  return y;
+  ay->envelope_step = 0;
+  ay->envelope = Envelope_levels[ay->envelope_shape][0];
 }
 
-void ayumi_process(struct ayumi* ay) {
+/*
+ * Always inlined with constant factor and size, so every quality tier
+ * gets its own unrolled loop.
+ */
+__attribute__((always_inline))
+static inline void process_frame(struct ayumi* ay, double* x, int* fir_index,
+  ayumi_sample* left, ayumi_sample* right, const int factor, const int size) {
   int i;
-  double y1;
-  double* c_left = ay->interpolator_left.c;
-  double* y_left = ay->interpolator_left.y;
-  double* c_right = ay->interpolator_right.c;
-  double* y_right = ay->interpolator_right.y;
-  double* fir_left = &ay->fir_left[FIR_SIZE - ay->fir_index * DECIMATE_FACTOR];
-  double* fir_right = &ay->fir_right[FIR_SIZE - ay->fir_index * DECIMATE_FACTOR];
-  ay->fir_index = (ay->fir_index + 1) % (FIR_SIZE / DECIMATE_FACTOR - 1);
-  for (i = DECIMATE_FACTOR - 1; i >= 0; i -= 1) {
-    ay->x += ay->step;
-    if (ay->x >= 1) {
-      ay->x -= 1;
+  int changed;
+  ayumi_sample y1;
+  ayumi_sample t;
+  ayumi_sample* c_left = ay->interpolator_left.c;
+  ayumi_sample* y_left = ay->interpolator_left.y;
+  ayumi_sample* c_right = ay->interpolator_right.c;
+  ayumi_sample* y_right = ay->interpolator_right.y;
+  ayumi_sample (*fir)[2];
+  ayumi_sample y[2];
+#ifdef AYUMI_STATS
+  uint64_t start = ayumi_cycles();
+  uint64_t mark;
+  uint64_t ticking = 0;
+#endif
+  *fir_index = (*fir_index == 0 ? size : *fir_index) - factor;
+  fir = &ay->fir[*fir_index];
+  for (i = factor - 1; i >= 0; i -= 1) {
+    *x += ay->step;
+    if (*x >= 1) {
+      /* More than one tick per frame, only in the draft tier at low sample rates */
+      changed = 0;
+      STATS_MARK(mark);
+      do {
+        *x -= 1;
+        changed |= update_mixer(ay);
+        STATS_ADD(ay, ticks, 1);
+      } while (*x >= 1);
+#ifdef AYUMI_STATS
+      ticking += ayumi_cycles() - mark;
+#endif
+      if (!changed && ay->flat >= 3) {
+        goto interpolate;
+      }
+      ay->flat = y_left[3] == SAMPLE(ay->mixer_left) && y_right[3] == SAMPLE(ay->mixer_right) ?
+        ay->flat + 1 : 0;
       y_left[0] = y_left[1];
       y_left[1] = y_left[2];
       y_left[2] = y_left[3];
       y_right[0] = y_right[1];
       y_right[1] = y_right[2];
       y_right[2] = y_right[3];
-      update_mixer(ay);
-      y_left[3] = ay->left;
-      y_right[3] = ay->right;
+      y_left[3] = SAMPLE(ay->mixer_left);
+      y_right[3] = SAMPLE(ay->mixer_right);
       y1 = y_left[2] - y_left[0];
-      c_left[0] = 0.5 * y_left[1] + 0.25 * (y_left[0] + y_left[2]);
-      c_left[1] = 0.5 * y1;
-      c_left[2] = 0.25 * (y_left[3] - y_left[1] - y1);
+      c_left[0] = SAMPLE_MUL(SAMPLE(0.5), y_left[1]) + SAMPLE_MUL(SAMPLE(0.25), y_left[0] + y_left[2]);
+      c_left[1] = SAMPLE_MUL(SAMPLE(0.5), y1);
+      c_left[2] = SAMPLE_MUL(SAMPLE(0.25), y_left[3] - y_left[1] - y1);
       y1 = y_right[2] - y_right[0];
-      c_right[0] = 0.5 * y_right[1] + 0.25 * (y_right[0] + y_right[2]);
-      c_right[1] = 0.5 * y1;
-      c_right[2] = 0.25 * (y_right[3] - y_right[1] - y1);
+      c_right[0] = SAMPLE_MUL(SAMPLE(0.5), y_right[1]) + SAMPLE_MUL(SAMPLE(0.25), y_right[0] + y_right[2]);
+      c_right[1] = SAMPLE_MUL(SAMPLE(0.5), y1);
+      c_right[2] = SAMPLE_MUL(SAMPLE(0.25), y_right[3] - y_right[1] - y1);
+    }
+interpolate:
+    t = SAMPLE(*x);
+    fir[i][0] = SAMPLE_MUL(SAMPLE_MUL(c_left[2], t) + c_left[1], t) + c_left[0];
+    fir[i][1] = SAMPLE_MUL(SAMPLE_MUL(c_right[2], t) + c_right[1], t) + c_right[0];
+    fir[i + size][0] = fir[i][0];
+    fir[i + size][1] = fir[i][1];
+  }
+#ifdef AYUMI_STATS
+  mark = ayumi_cycles();
+  ay->stats.tick_cycles += ticking;
+  ay->stats.interpolate_cycles += mark - start - ticking;
+  ay->stats.frames += 1;
+#endif
+  ay->decimate((const ayumi_sample (*)[2]) fir, y);
+  STATS_SINCE(ay, decimate_cycles, mark);
+  *left = y[0];
+  *right = y[1];
+}
+
+/*
+ * process_frame() for a mono chip, on the left interpolator. The reversed
+ * ring moves up as the forward one moves down, both by factor samples.
+ */
+__attribute__((always_inline))
+static inline void process_frame_mono(struct ayumi* ay, double* x, int* fir_index, int* mono_index,
+  ayumi_sample* left, ayumi_sample* right, const int factor, const int size) {
+  int i, j;
+  int changed;
+  ayumi_sample y1;
+  ayumi_sample t;
+  ayumi_sample m;
+  ayumi_sample* c = ay->interpolator_left.c;
+  ayumi_sample* y = ay->interpolator_left.y;
+  ayumi_sample* forward;
+  ayumi_sample* reversed = MONO_REVERSED(ay);
+#ifdef AYUMI_STATS
+  uint64_t start = ayumi_cycles();
+  uint64_t mark;
+  uint64_t ticking = 0;
+#endif
+  *fir_index = (*fir_index == 0 ? size : *fir_index) - factor;
+  *mono_index = *mono_index + factor == size ? 0 : *mono_index + factor;
+  forward = MONO_FORWARD(ay) + *fir_index;
+  for (i = factor - 1; i >= 0; i -= 1) {
+    *x += ay->step;
+    if (*x >= 1) {
+      changed = 0;
+      STATS_MARK(mark);
+      do {
+        *x -= 1;
+        changed |= update_mixer(ay);
+        STATS_ADD(ay, ticks, 1);
+      } while (*x >= 1);
+#ifdef AYUMI_STATS
+      ticking += ayumi_cycles() - mark;
+#endif
+      if (!changed && ay->flat >= 3) {
+        goto interpolate;
+      }
+      m = SAMPLE(ay->mixer_left + ay->mixer_right);
+      ay->flat = y[3] == m ? ay->flat + 1 : 0;
+      y[0] = y[1];
+      y[1] = y[2];
+      y[2] = y[3];
+      y[3] = m;
+      y1 = y[2] - y[0];
+      c[0] = SAMPLE_MUL(SAMPLE(0.5), y[1]) + SAMPLE_MUL(SAMPLE(0.25), y[0] + y[2]);
+      c[1] = SAMPLE_MUL(SAMPLE(0.5), y1);
+      c[2] = SAMPLE_MUL(SAMPLE(0.25), y[3] - y[1] - y1);
+    }
+interpolate:
+    t = SAMPLE(*x);
+    forward[i] = SAMPLE_MUL(SAMPLE_MUL(c[2], t) + c[1], t) + c[0];
+    forward[i + size] = forward[i];
+    j = *mono_index + size - i;
+    j -= j >= size ? size : 0;
+    reversed[j] = forward[i];
+    reversed[j + size] = forward[i];
+  }
+#ifdef AYUMI_STATS
+  mark = ayumi_cycles();
+  ay->stats.tick_cycles += ticking;
+  ay->stats.interpolate_cycles += mark - start - ticking;
+  ay->stats.frames += 1;
+#endif
+  m = ay->decimate_mono(forward, reversed + *mono_index);
+  STATS_SINCE(ay, decimate_cycles, mark);
+  *left = SAMPLE_MUL(SAMPLE(ay->mono_left), m);
+  *right = SAMPLE_MUL(SAMPLE(ay->mono_right), m);
+}
+
+/*
+ * Spreads a level change over the ring of pending steps, starting at
+ * index. phase is how far before the end of the frame it happened, in
+ * output samples. The last tap takes the rounding, so that the steps of a
+ * change always add up to exactly delta.
+ */
+static void add_step(ayumi_sample (*ring)[2], int index, double phase,
+  ayumi_sample delta_left, ayumi_sample delta_right) {
+  int i, j;
+  double q = phase * BLEP_PHASES;
+  int row = q < BLEP_PHASES - 1 ? (int) q : BLEP_PHASES - 1;
+  ayumi_sample t = SAMPLE(q - row);
+  const ayumi_sample* a = Blep_taps[row];
+  const ayumi_sample* b = Blep_taps[row + 1];
+  ayumi_sample k, l, r;
+  ayumi_sample sum_left = 0;
+  ayumi_sample sum_right = 0;
+  for (i = 0; i < BLEP_TAPS - 1; i += 1) {
+    k = a[i] + SAMPLE_MUL(b[i] - a[i], t);
+    l = SAMPLE_MUL(delta_left, k);
+    r = SAMPLE_MUL(delta_right, k);
+    j = (index + i) & (BLEP_TAPS - 1);
+    ring[j][0] += l;
+    ring[j][1] += r;
+    sum_left += l;
+    sum_right += r;
+  }
+  j = (index + BLEP_TAPS - 1) & (BLEP_TAPS - 1);
+  ring[j][0] += delta_left - sum_left;
+  ring[j][1] += delta_right - sum_right;
+}
+
+/*
+ * One output frame of the BLEP engine. Ticks that only count down are
+ * taken in one go, a tick that mixes adds a step if the level changed.
+ * The output is the running sum of the ring, which is cleared behind it.
+ * Once no step is pending the sum is set to the mixer level, so that
+ * rounding cannot build up.
+ */
+__attribute__((always_inline))
+static inline void blep_frame(struct ayumi* ay, double* x, int* index,
+  ayumi_sample* left, ayumi_sample* right) {
+  int n;
+  double mixer_left, mixer_right;
+  ayumi_sample l, r;
+  ayumi_sample (*ring)[2] = ay->fir;
+  *x += ay->frame_ticks;
+  while (*x >= 1) {
+    if (ay->skip > 0) {
+      n = ay->skip < *x ? ay->skip : (int) *x;
+      ay->skip -= n;
+      ay->pending += n;
+      *x -= n;
+      STATS_ADD(ay, ticks, n);
+      continue;
+    }
+    *x -= 1;
+    mixer_left = ay->mixer_left;
+    mixer_right = ay->mixer_right;
+    update_mixer(ay);
+    STATS_ADD(ay, ticks, 1);
+    l = SAMPLE(ay->mixer_left) - SAMPLE(mixer_left);
+    r = SAMPLE(ay->mixer_right) - SAMPLE(mixer_right);
+    if (l != 0 || r != 0) {
+      add_step(ring, *index, *x / ay->frame_ticks, l, r);
+      ay->flat = 0;
+    }
+  }
+  ay->blep_left += ring[*index][0];
+  ay->blep_right += ring[*index][1];
+  ring[*index][0] = 0;
+  ring[*index][1] = 0;
+  *index = (*index + 1) & (BLEP_TAPS - 1);
+  if (ay->flat < BLEP_TAPS) {
+    ay->flat += 1;
+    if (ay->flat == BLEP_TAPS) {
+      ay->blep_left = SAMPLE(ay->mixer_left);
+      ay->blep_right = SAMPLE(ay->mixer_right);
     }
-    fir_left[i] = (c_left[2] * ay->x + c_left[1]) * ay->x + c_left[0];
-    fir_right[i] = (c_right[2] * ay->x + c_right[1]) * ay->x + c_right[0];
   }
-  ay->left = decimate(fir_left);
-  ay->right = decimate(fir_right);
+  STATS_ADD(ay, frames, 1);
+  *left = ay->blep_left;
+  *right = ay->blep_right;
+}
+
+void ayumi_process(struct ayumi* ay) {
+  ayumi_sample left, right;
+  if (ay->engine == AYUMI_ENGINE_BLEP) {
+    blep_frame(ay, &ay->x, &ay->fir_index, &left, &right);
+    ay->left = SAMPLE_TO_DOUBLE(left);
+    ay->right = SAMPLE_TO_DOUBLE(right);
+    return;
+  }
+  switch (ay->quality + ay->mono * 3) {
+  case AYUMI_QUALITY_DRAFT:
+    process_frame(ay, &ay->x, &ay->fir_index, &left, &right, DECIMATE_FACTOR_DRAFT, FIR_SIZE_DRAFT);
+    break;
+  case AYUMI_QUALITY_HIGH:
+    process_frame(ay, &ay->x, &ay->fir_index, &left, &right, DECIMATE_FACTOR_HIGH, FIR_SIZE_HIGH);
+    break;
+  case AYUMI_QUALITY_DRAFT + 3:
+    process_frame_mono(ay, &ay->x, &ay->fir_index, &ay->mono_index, &left, &right,
+      DECIMATE_FACTOR_DRAFT, FIR_SIZE_DRAFT);
+    break;
+  case AYUMI_QUALITY_STANDARD + 3:
+    process_frame_mono(ay, &ay->x, &ay->fir_index, &ay->mono_index, &left, &right,
+      DECIMATE_FACTOR, FIR_SIZE);
+    break;
+  case AYUMI_QUALITY_HIGH + 3:
+    process_frame_mono(ay, &ay->x, &ay->fir_index, &ay->mono_index, &left, &right,
+      DECIMATE_FACTOR_HIGH, FIR_SIZE_HIGH);
+    break;
+  default:
+    process_frame(ay, &ay->x, &ay->fir_index, &left, &right, DECIMATE_FACTOR, FIR_SIZE);
+    break;
+  }
+  ay->left = SAMPLE_TO_DOUBLE(left);
+  ay->right = SAMPLE_TO_DOUBLE(right);
+  if (ay->mono_wait > 0) {
+    wait_mono(ay, 1);
+  }
+}
+
+#ifdef AYUMI_COMPACT
+
+/* y = x - x' + p * y', settles in about DC_FILTER_SIZE samples like the boxcar */
+#define DC_POLE (1 - 4.0 / DC_FILTER_SIZE)
+
+/*
+ * On a constant input the sum decays towards zero and turns subnormal after
+ * a few seconds, which is slow on most FPUs. Adding and taking back DC_FLUSH
+ * rounds anything below about 1e-36 to zero and leaves larger sums exact.
+ */
+#define DC_FLUSH 1e-20
+
+static inline ayumi_sample dc_filter(struct dc_filter* dc, int index, ayumi_sample x) {
+  (void) index;
+  dc->sum = ACCUM_SCALE(dc->sum, DC_POLE) + x - dc->last;
+#ifndef AYUMI_SAMPLE_FIXED
+  dc->sum = dc->sum + DC_FLUSH - DC_FLUSH;
+#endif
+  dc->last = x;
+  return (ayumi_sample) dc->sum;
+}
+
+static void settle_dc(struct dc_filter* dc, ayumi_sample x) {
+  dc->sum = 0;
+  dc->last = x;
 }
 
-static double dc_filter(struct dc_filter* dc, int index, double x) {
-  dc->sum += -dc->delay[index] + x;
+#else
+
+static inline ayumi_sample dc_filter(struct dc_filter* dc, int index, ayumi_sample x) {
+  dc->sum += -(ayumi_accum) dc->delay[index] + x;
   dc->delay[index] = x; 
-  return x - dc->sum / DC_FILTER_SIZE;
+  return x - (ayumi_sample) (dc->sum / DC_FILTER_SIZE);
+}
+
+static void settle_dc(struct dc_filter* dc, ayumi_sample x) {
+  int i;
+  for (i = 0; i < DC_FILTER_SIZE; i += 1) {
+    dc->delay[i] = x;
+  }
+  dc->sum = (ayumi_accum) x * DC_FILTER_SIZE;
 }
 
+#endif
+
 void ayumi_remove_dc(struct ayumi* ay) {
-  ay->left = dc_filter(&ay->dc_left, ay->dc_index, ay->left);
-  ay->right = dc_filter(&ay->dc_right, ay->dc_index, ay->right);
+  ay->left = SAMPLE_TO_DOUBLE(dc_filter(&ay->dc_left, ay->dc_index, SAMPLE(ay->left)));
+  ay->right = SAMPLE_TO_DOUBLE(dc_filter(&ay->dc_right, ay->dc_index, SAMPLE(ay->right)));
   ay->dc_index = (ay->dc_index + 1) & (DC_FILTER_SIZE - 1);
 }
+
+/* Takes the counters up to date first, so the state is that of the last tick */
+void ayumi_save_state(struct ayumi* ay, struct ayumi_state* s) {
+  int i;
+  struct tone_channel* ch;
+  sync_counters(ay);
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ch = &ay->channels[i];
+    s->tone_period[i] = ch->tone_period;
+    s->tone_counter[i] = ch->tone_counter;
+    s->tone[i] = ch->tone;
+    s->mixer[i] = ch->t_off | (ch->n_off << 1) | ((ch->e_on != 0) << 2);
+    s->volume[i] = ch->volume;
+    s->pan_left[i] = ch->pan_left;
+    s->pan_right[i] = ch->pan_right;
+  }
+  s->noise_period = ay->noise_period;
+  s->noise_counter = ay->noise_counter;
+  s->noise = ay->noise;
+  s->envelope_period = ay->envelope_period;
+  s->envelope_counter = ay->envelope_counter;
+  s->envelope_shape = ay->envelope_shape;
+  s->envelope_step = ay->envelope_step;
+  s->x = ay->x;
+}
+
+static int clamp_counter(int counter) {
+  return counter < 0 ? 0 : counter > 0xffff ? 0xffff : counter;
+}
+
+/* NaN fails the first test too */
+static double clamp_pan(double pan) {
+  return !(pan >= 0) ? 0 : pan > 1 ? 1 : pan;
+}
+
+/*
+ * Values out of range, from a damaged or foreign state, are clamped. The
+ * interpolator, FIR or BLEP ring and DC filter are filled with the level
+ * the restored state mixes to, so playback resumes from it without a
+ * click and without rendering anything first.
+ */
+void ayumi_load_state(struct ayumi* ay, const struct ayumi_state* s) {
+  int i, out, noise;
+  ayumi_sample l, r;
+  struct tone_channel* ch;
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ch = &ay->channels[i];
+    ayumi_set_tone(ay, i, s->tone_period[i]);
+    ayumi_set_mixer(ay, i, s->mixer[i] & 1, (s->mixer[i] >> 1) & 1, (s->mixer[i] >> 2) & 1);
+    ayumi_set_volume(ay, i, s->volume[i]);
+    ch->tone_counter = clamp_counter(s->tone_counter[i]);
+    ch->tone = s->tone[i] & 1;
+    ch->pan_left = clamp_pan(s->pan_left[i]);
+    ch->pan_right = clamp_pan(s->pan_right[i]);
+  }
+  ayumi_set_noise(ay, s->noise_period);
+  ay->noise_counter = clamp_counter(s->noise_counter);
+  ay->noise = s->noise < 0 ? 0 : s->noise % NOISE_SEQUENCE;
+  ayumi_set_envelope(ay, s->envelope_period);
+  ay->envelope_shape = s->envelope_shape & 0xf;
+  ay->envelope_counter = clamp_counter(s->envelope_counter);
+  ay->envelope_step = s->envelope_step & 63;
+  ay->envelope = Envelope_levels[ay->envelope_shape][ay->envelope_step];
+  ay->x = s->x >= 0 && s->x < 1 ? s->x : 0;
+  ay->pending = 0;
+  ay->skip = 0;
+  ay->mixer_left = 0;
+  ay->mixer_right = 0;
+  noise = noise_bit(ay);
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ch = &ay->channels[i];
+    out = channel_out(ch, noise, ay->envelope);
+    ay->mixer_left += ay->dac_table[out] * ch->pan_left;
+    ay->mixer_right += ay->dac_table[out] * ch->pan_right;
+  }
+  ayumi_set_engine(ay, ay->engine);
+  l = SAMPLE(ay->mixer_left);
+  r = SAMPLE(ay->mixer_right);
+  settle_dc(&ay->dc_left, l);
+  settle_dc(&ay->dc_right, r);
+  ay->left = ay->mixer_left;
+  ay->right = ay->mixer_right;
+}
+
+__attribute__((always_inline))
+static inline void process_block(struct ayumi* ay, float* left, float* right, int count, int remove_dc,
+  const int factor, const int size, const int mono) {
+  int i;
+  double x = ay->x;
+  int fir_index = ay->fir_index;
+  int mono_index = ay->mono_index;
+  int dc_index = ay->dc_index;
+  ayumi_sample l = SAMPLE(ay->left);
+  ayumi_sample r = SAMPLE(ay->right);
+#ifdef AYUMI_STATS
+  uint64_t mark;
+#endif
+  for (i = 0; i < count; i += 1) {
+    if (factor == 0) {
+      blep_frame(ay, &x, &fir_index, &l, &r);
+    } else if (mono) {
+      process_frame_mono(ay, &x, &fir_index, &mono_index, &l, &r, factor, size);
+    } else {
+      process_frame(ay, &x, &fir_index, &l, &r, factor, size);
+    }
+    if (remove_dc) {
+      STATS_MARK(mark);
+      l = dc_filter(&ay->dc_left, dc_index, l);
+      r = dc_filter(&ay->dc_right, dc_index, r);
+      dc_index = (dc_index + 1) & (DC_FILTER_SIZE - 1);
+      STATS_SINCE(ay, dc_cycles, mark);
+    }
+    left[i] = (float) SAMPLE_TO_DOUBLE(l);
+    right[i] = (float) SAMPLE_TO_DOUBLE(r);
+  }
+  ay->x = x;
+  ay->fir_index = fir_index;
+  ay->mono_index = mono_index;
+  ay->dc_index = dc_index;
+  ay->left = SAMPLE_TO_DOUBLE(l);
+  ay->right = SAMPLE_TO_DOUBLE(r);
+}
+
+/* Factor 0 selects the BLEP engine */
+static void process_block_blep(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  process_block(ay, left, right, count, remove_dc, 0, 0, 0);
+}
+
+static void process_block_draft(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  process_block(ay, left, right, count, remove_dc, DECIMATE_FACTOR_DRAFT, FIR_SIZE_DRAFT, 0);
+}
+
+static void process_block_standard(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  process_block(ay, left, right, count, remove_dc, DECIMATE_FACTOR, FIR_SIZE, 0);
+}
+
+static void process_block_high(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  process_block(ay, left, right, count, remove_dc, DECIMATE_FACTOR_HIGH, FIR_SIZE_HIGH, 0);
+}
+
+static void process_block_mono_draft(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  process_block(ay, left, right, count, remove_dc, DECIMATE_FACTOR_DRAFT, FIR_SIZE_DRAFT, 1);
+}
+
+static void process_block_mono_standard(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  process_block(ay, left, right, count, remove_dc, DECIMATE_FACTOR, FIR_SIZE, 1);
+}
+
+static void process_block_mono_high(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  process_block(ay, left, right, count, remove_dc, DECIMATE_FACTOR_HIGH, FIR_SIZE_HIGH, 1);
+}
+
+/*
+ * Returns 1 if no tone, noise or envelope change can reach the output,
+ * with the level mix() would compute.
+ */
+static int is_static(struct ayumi* ay, double* left, double* right) {
+  int i;
+  int out;
+  struct tone_channel* ch;
+  *left = 0;
+  *right = 0;
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ch = &ay->channels[i];
+    if (ch->e_on && is_sliding(ay)) {
+      return 0;
+    }
+    out = ch->e_on ? ay->envelope : ch->volume * 2 + 1;
+    if (!(ch->t_off && ch->n_off) && out != 0) {
+      return 0;
+    }
+    *left += ay->dac_table[out] * ch->pan_left;
+    *right += ay->dac_table[out] * ch->pan_right;
+  }
+  return 1;
+}
+
+/*
+ * Static mixer output, a flat interpolator and a FIR history holding its
+ * value: from here on every frame decimates to the same sample.
+ */
+static int is_settled(struct ayumi* ay) {
+  int i;
+  double left, right;
+  ayumi_sample* forward = MONO_FORWARD(ay);
+  ayumi_sample l = ay->interpolator_left.c[0];
+  ayumi_sample r = ay->interpolator_right.c[0];
+  if (ay->flat < 3 || !is_static(ay, &left, &right)) {
+    return 0;
+  }
+  if (ay->mono) {
+    /* Both rings hold the same samples */
+    if (ay->interpolator_left.y[3] != SAMPLE(left + right)) {
+      return 0;
+    }
+    for (i = 0; i < Fir_sizes[ay->quality] * 2; i += 1) {
+      if (forward[i] != l) {
+        return 0;
+      }
+    }
+    return 1;
+  }
+  if (ay->interpolator_left.y[3] != SAMPLE(left) || ay->interpolator_right.y[3] != SAMPLE(right)) {
+    return 0;
+  }
+  for (i = 0; i < Fir_sizes[ay->quality] * 2; i += 1) {
+    if (ay->fir[i][0] != l || ay->fir[i][1] != r) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/*
+ * Moves the tick phase over count output frames with the same additions
+ * the renderers make, so it ends up bit for bit where they leave it.
+ * Returns the number of ticks.
+ */
+static int tick_frames(struct ayumi* ay, int count) {
+  int i, j;
+  int ticks = 0;
+  int factor = ay->engine == AYUMI_ENGINE_BLEP ? 1 : Decimate_factors[ay->quality];
+  double step = ay->engine == AYUMI_ENGINE_BLEP ? ay->frame_ticks : ay->step;
+  double x = ay->x;
+  for (i = 0; i < count; i += 1) {
+    for (j = 0; j < factor; j += 1) {
+      x += step;
+      while (x >= 1) {
+        x -= 1;
+        ticks += 1;
+      }
+    }
+  }
+  ay->x = x;
+  return ticks;
+}
+
+/*
+ * Produces the same output and state as rendering a settled chip: only
+ * the tick phase, the counters, the FIR position and the DC filter move.
+ */
+static void skip_block(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  int i;
+  int ticks = tick_frames(ay, count);
+  int factor = Decimate_factors[ay->quality];
+  int size = Fir_sizes[ay->quality];
+  int dc_index = ay->dc_index;
+  ayumi_sample y[2];
+  ayumi_sample l = SAMPLE(ay->left);
+  ayumi_sample r = SAMPLE(ay->right);
+  if (ay->mono) {
+    l = ay->decimate_mono(MONO_FORWARD(ay), MONO_REVERSED(ay));
+    y[0] = SAMPLE_MUL(SAMPLE(ay->mono_left), l);
+    y[1] = SAMPLE_MUL(SAMPLE(ay->mono_right), l);
+  } else {
+    ay->decimate((const ayumi_sample (*)[2]) ay->fir, y);
+  }
+  for (i = 0; i < count; i += 1) {
+    l = y[0];
+    r = y[1];
+    if (remove_dc) {
+      l = dc_filter(&ay->dc_left, dc_index, l);
+      r = dc_filter(&ay->dc_right, dc_index, r);
+      dc_index = (dc_index + 1) & (DC_FILTER_SIZE - 1);
+    }
+    left[i] = (float) SAMPLE_TO_DOUBLE(l);
+    right[i] = (float) SAMPLE_TO_DOUBLE(r);
+  }
+  ay->pending += ticks;
+  sync_counters(ay);
+  STATS_ADD(ay, ticks, ticks);
+  STATS_ADD(ay, frames, count);
+  STATS_ADD(ay, skipped_frames, count);
+  ay->fir_index = (ay->fir_index + size - count % (size / factor) * factor) % size;
+  ay->mono_index = (ay->mono_index + count % (size / factor) * factor) % size;
+  ay->dc_index = dc_index;
+  ay->left = SAMPLE_TO_DOUBLE(l);
+  ay->right = SAMPLE_TO_DOUBLE(r);
+}
+
+/*
+ * Moves the chip count output frames on without rendering them. The tick
+ * phase and the counters end up where ayumi_process_block() would leave
+ * them, the mixer output and the filters are not touched. A cheap pass
+ * to take ayumi_save_state() checkpoints along a register stream.
+ */
+void ayumi_advance(struct ayumi* ay, int count) {
+  ay->pending += tick_frames(ay, count);
+  sync_counters(ay);
+}
+
+static void process_block_fir(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  switch (ay->quality + ay->mono * 3) {
+  case AYUMI_QUALITY_DRAFT:
+    process_block_draft(ay, left, right, count, remove_dc);
+    break;
+  case AYUMI_QUALITY_HIGH:
+    process_block_high(ay, left, right, count, remove_dc);
+    break;
+  case AYUMI_QUALITY_DRAFT + 3:
+    process_block_mono_draft(ay, left, right, count, remove_dc);
+    break;
+  case AYUMI_QUALITY_STANDARD + 3:
+    process_block_mono_standard(ay, left, right, count, remove_dc);
+    break;
+  case AYUMI_QUALITY_HIGH + 3:
+    process_block_mono_high(ay, left, right, count, remove_dc);
+    break;
+  default:
+    process_block_standard(ay, left, right, count, remove_dc);
+    break;
+  }
+}
+
+static void render_block(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  if (is_settled(ay)) {
+    skip_block(ay, left, right, count, remove_dc);
+  } else {
+    process_block_fir(ay, left, right, count, remove_dc);
+  }
+}
+
+/*
+ * The block is split where the wait for mono runs out, so the chip turns
+ * mono after the same frame as with ayumi_process, whatever the block size.
+ */
+void ayumi_process_block(struct ayumi* ay, float* left, float* right, int count, int remove_dc) {
+  int n;
+  if (ay->engine == AYUMI_ENGINE_BLEP) {
+    process_block_blep(ay, left, right, count, remove_dc);
+    return;
+  }
+  if (ay->mono_wait > 0 && ay->mono_wait < count) {
+    n = ay->mono_wait;
+    render_block(ay, left, right, n, remove_dc);
+    wait_mono(ay, n);
+    left += n;
+    right += n;
+    count -= n;
+  }
+  render_block(ay, left, right, count, remove_dc);
+  if (ay->mono_wait > 0) {
+    wait_mono(ay, count);
+  }
+}
+
+/* Per-channel DAC levels of the last mix, for the stems */
+__attribute__((always_inline))
+static inline void channel_levels(struct ayumi* ay, double* level) {
+  int i;
+  int noise = noise_bit(ay);
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    level[i] = ay->dac_table[channel_out(&ay->channels[i], noise, ay->envelope)];
+  }
+}
+
+/*
+ * Starts the stems from silence, like a chip fresh from ayumi_configure().
+ * The FIR follows the quality tier of the chip.
+ */
+void ayumi_stems_configure(struct ayumi_stems* s, struct ayumi* ay) {
+  memset(s, 0, sizeof(struct ayumi_stems));
+  s->quality = ay->quality;
+}
+
+/* The interpolator and FIR of the chip, with one lane per tone channel */
+__attribute__((always_inline))
+static inline void stems_frame(struct ayumi* ay, struct ayumi_stems* s, double* x, int* fir_index,
+  double* y, ayumi_stem_decimator decimate, const int factor, const int size) {
+  int i, l;
+  int changed;
+  double t;
+  double (*fir)[AYUMI_STEM_LANES];
+  ayumi_stem_lanes y1;
+  *fir_index = (*fir_index == 0 ? size : *fir_index) - factor;
+  fir = &s->fir[*fir_index];
+  for (i = factor - 1; i >= 0; i -= 1) {
+    *x += ay->step;
+    if (*x >= 1) {
+      changed = 0;
+      do {
+        *x -= 1;
+        changed |= update_mixer(ay);
+        STATS_ADD(ay, ticks, 1);
+      } while (*x >= 1);
+      if (changed) {
+        channel_levels(ay, s->level);
+      } else if (s->flat >= 3) {
+        goto interpolate;
+      }
+      for (l = 0; l < TONE_CHANNELS && s->y[3][l] == s->level[l]; l += 1) {
+      }
+      s->flat = l == TONE_CHANNELS ? s->flat + 1 : 0;
+      STEM_LANES(s->y[0]) = STEM_LANES(s->y[1]);
+      STEM_LANES(s->y[1]) = STEM_LANES(s->y[2]);
+      STEM_LANES(s->y[2]) = STEM_LANES(s->y[3]);
+      STEM_LANES(s->y[3]) = STEM_LANES(s->level);
+      y1 = STEM_LANES(s->y[2]) - STEM_LANES(s->y[0]);
+      STEM_LANES(s->c[0]) = 0.5 * STEM_LANES(s->y[1]) + 0.25 * (STEM_LANES(s->y[0]) + STEM_LANES(s->y[2]));
+      STEM_LANES(s->c[1]) = 0.5 * y1;
+      STEM_LANES(s->c[2]) = 0.25 * (STEM_LANES(s->y[3]) - STEM_LANES(s->y[1]) - y1);
+    }
+interpolate:
+    t = *x;
+    STEM_LANES(fir[i]) = (STEM_LANES(s->c[2]) * t + STEM_LANES(s->c[1])) * t + STEM_LANES(s->c[0]);
+    STEM_LANES(fir[i + size]) = STEM_LANES(fir[i]);
+  }
+  STATS_ADD(ay, frames, 1);
+  decimate((const double (*)[AYUMI_STEM_LANES]) fir, y);
+}
+
+static inline void stems_dc_filter(struct ayumi_stems* s, int index, double* x) {
+#ifdef AYUMI_COMPACT
+  (void) index;
+  STEM_LANES(s->dc_sum) = STEM_LANES(s->dc_sum) * DC_POLE + STEM_LANES(x) - STEM_LANES(s->dc_last);
+  STEM_LANES(s->dc_sum) = STEM_LANES(s->dc_sum) + DC_FLUSH - DC_FLUSH;
+  STEM_LANES(s->dc_last) = STEM_LANES(x);
+  STEM_LANES(x) = STEM_LANES(s->dc_sum);
+#else
+  STEM_LANES(s->dc_sum) += -STEM_LANES(s->dc_delay[index]) + STEM_LANES(x);
+  STEM_LANES(s->dc_delay[index]) = STEM_LANES(x);
+  STEM_LANES(x) = STEM_LANES(x) - STEM_LANES(s->dc_sum) / DC_FILTER_SIZE;
+#endif
+}
+
+/*
+ * Fills the stems filters with the current channel levels, as if the chip
+ * had held them. For after ayumi_load_state().
+ */
+void ayumi_stems_settle(struct ayumi_stems* s, struct ayumi* ay) {
+  int i;
+  double level[AYUMI_STEM_LANES] = {0};
+  ayumi_stems_configure(s, ay);
+  channel_levels(ay, level);
+  STEM_LANES(s->level) = STEM_LANES(level);
+  for (i = 0; i < 4; i += 1) {
+    STEM_LANES(s->y[i]) = STEM_LANES(level);
+  }
+  STEM_LANES(s->c[0]) = STEM_LANES(level);
+  for (i = 0; i < AYUMI_FIR_MAX * 2; i += 1) {
+    STEM_LANES(s->fir[i]) = STEM_LANES(level);
+  }
+#ifdef AYUMI_COMPACT
+  STEM_LANES(s->dc_last) = STEM_LANES(level);
+#else
+  STEM_LANES(s->dc_sum) = STEM_LANES(level) * DC_FILTER_SIZE;
+  for (i = 0; i < DC_FILTER_SIZE; i += 1) {
+    STEM_LANES(s->dc_delay[i]) = STEM_LANES(level);
+  }
+#endif
+}
+
+__attribute__((always_inline))
+static inline void process_stems(struct ayumi* ay, struct ayumi_stems* s, float* const* stems,
+  float* left, float* right, int count, int remove_dc, const int factor, const int size) {
+  int i, j;
+  double x = ay->x;
+  int fir_index = s->fir_index;
+  ayumi_stem_decimator decimate = ayumi_stem_decimator_get(ay->simd, ay->quality);
+  double y[AYUMI_STEM_LANES];
+  double l = ay->left;
+  double r = ay->right;
+  for (i = 0; i < count; i += 1) {
+    stems_frame(ay, s, &x, &fir_index, y, decimate, factor, size);
+    if (remove_dc) {
+      stems_dc_filter(s, s->dc_index, y);
+      s->dc_index = (s->dc_index + 1) & (DC_FILTER_SIZE - 1);
+    }
+    l = 0;
+    r = 0;
+    for (j = 0; j < TONE_CHANNELS; j += 1) {
+      if (stems[j]) {
+        stems[j][i] = (float) y[j];
+      }
+      l += y[j] * ay->channels[j].pan_left;
+      r += y[j] * ay->channels[j].pan_right;
+    }
+    if (left) {
+      left[i] = (float) l;
+    }
+    if (right) {
+      right[i] = (float) r;
+    }
+  }
+  ay->x = x;
+  s->fir_index = fir_index;
+  ay->left = l;
+  ay->right = r;
+}
+
+/*
+ * Renders the tone channels one per stem, and their panned sum into left
+ * and right. Any output may be NULL. The chip ticks as with
+ * ayumi_process_block(), its own filters and its engine are left alone.
+ * Pans apply at the output rate, after the FIR.
+ */
+AYUMI_CLONES
+void ayumi_process_stems(struct ayumi* ay, struct ayumi_stems* s, float* const* stems,
+  float* left, float* right, int count, int remove_dc) {
+  int i;
+  if (s->quality != ay->quality) {
+    /* Like ayumi_set_quality(), the new tier starts from the last level */
+    s->quality = ay->quality;
+    s->fir_index = 0;
+    for (i = 0; i < AYUMI_FIR_MAX * 2; i += 1) {
+      STEM_LANES(s->fir[i]) = STEM_LANES(s->y[3]);
+    }
+  }
+  switch (ay->quality) {
+  case AYUMI_QUALITY_DRAFT:
+    process_stems(ay, s, stems, left, right, count, remove_dc, DECIMATE_FACTOR_DRAFT, FIR_SIZE_DRAFT);
+    break;
+  case AYUMI_QUALITY_HIGH:
+    process_stems(ay, s, stems, left, right, count, remove_dc, DECIMATE_FACTOR_HIGH, FIR_SIZE_HIGH);
+    break;
+  default:
+    process_stems(ay, s, stems, left, right, count, remove_dc, DECIMATE_FACTOR, FIR_SIZE);
+    break;
+  }
+}
@@ -0,0 +1,582 @@
+/* Benchmark of the ayumi DSP stages, results are written as JSON */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <dlfcn.h>
+#include <getopt.h>
+#include <lv2/core/lv2.h>
+#include <lv2/atom/atom.h>
+#include <lv2/urid/urid.h>
+#include <lv2/midi/midi.h>
+#include "ayumi.h"
+
+enum {
+  BLOCK_SIZE = 256,
+  REPEATS = 3,
+  MAX_RESULTS = 512,
+  MAX_URIS = 64,
+  INSTANCES = 32
+};
+
+enum {
+  STAGE_TICK,
+  STAGE_DECIMATE,
+  STAGE_DC_FILTER,
+  STAGE_PROCESS,
+  STAGE_MONO,
+  STAGE_BLEP,
+  STAGE_STEMS,
+  STAGE_INSTANCES,
+  STAGE_LV2_RUN,
+  STAGE_COUNT
+};
+
+enum {
+  PATTERN_TONE,
+  PATTERN_ENVELOPE,
+  PATTERN_BUSY,
+  PATTERN_COUNT
+};
+
+/* Cases of the accuracy test, the quality tiers and then the BLEP engine */
+enum {
+  ACCURACY_BLEP = AYUMI_QUALITY_HIGH + 1,
+  ACCURACY_CASES,
+  ACCURACY_SECONDS = 40,
+  ACCURACY_RATE = 44100
+};
+
+static const char* stage_names[] = {"tick", "decimate", "dc_filter", "process", "process_mono",
+  "blep", "stems", "process_x32", "lv2_run"};
+static const char* pattern_names[] = {"tone", "envelope", "busy"};
+static const char* accuracy_names[] = {"draft", "standard", "high", "blep"};
+static const double clock_rates[] = {1773400, 2000000};
+static const int sample_rates[] = {44100, 48000, 96000, 192000};
+
+struct result {
+  char stage[16];
+  int clock_rate;
+  int sample_rate;
+  char dac[4];
+  char pattern[16];
+  double ns_per_frame;
+  double realtime;
+};
+
+struct bench {
+  double seconds;
+  int simd;
+  const LV2_Descriptor* plugin;
+  struct result results[MAX_RESULTS];
+  int count;
+};
+
+static struct ayumi ay;
+static struct ayumi_stems stems;
+static struct ayumi chips[INSTANCES];
+static float left[BLOCK_SIZE];
+static float right[BLOCK_SIZE];
+static float stem_outputs[TONE_CHANNELS][BLOCK_SIZE];
+static uint32_t seed;
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int random_int(int n) {
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+static void null_decimate(const ayumi_sample (*x)[2], ayumi_sample* y) {
+  y[0] = x[0][0];
+  y[1] = x[0][1];
+}
+
+/* Register writes of one 50 Hz frame, the same sequence in every run */
+static void write_pattern(struct ayumi* ay, int pattern, int frame) {
+  int i;
+  switch (pattern) {
+  case PATTERN_TONE:
+    if (frame == 0) {
+      for (i = 0; i < TONE_CHANNELS; i += 1) {
+        ayumi_set_tone(ay, i, 200 + i * 75);
+        ayumi_set_mixer(ay, i, 0, 1, 0);
+        ayumi_set_volume(ay, i, 12);
+      }
+    }
+    break;
+  case PATTERN_ENVELOPE:
+    if (frame == 0) {
+      ayumi_set_noise(ay, 7);
+      ayumi_set_envelope(ay, 300);
+      ayumi_set_envelope_shape(ay, 10);
+      for (i = 0; i < TONE_CHANNELS; i += 1) {
+        ayumi_set_tone(ay, i, 400 + i * 3);
+        ayumi_set_mixer(ay, i, 0, i != 1, 1);
+      }
+    }
+    break;
+  case PATTERN_BUSY:
+    ayumi_set_noise(ay, random_int(32));
+    ayumi_set_envelope(ay, random_int(1024));
+    if (frame % 8 == 0) {
+      ayumi_set_envelope_shape(ay, random_int(16));
+    }
+    for (i = 0; i < TONE_CHANNELS; i += 1) {
+      ayumi_set_tone(ay, i, random_int(4096));
+      ayumi_set_mixer(ay, i, random_int(2), random_int(2), random_int(2));
+      ayumi_set_volume(ay, i, random_int(16));
+    }
+    break;
+  }
+}
+
+/* Renders frames output frames of the core, returns the elapsed time */
+static double run_core(int stage, int pattern, int frames, int sr) {
+  int i, n, frame = 0;
+  int frame_size = sr / 50;
+  float* outputs[TONE_CHANNELS] = {stem_outputs[0], stem_outputs[1], stem_outputs[2]};
+  ayumi_sample (*fir)[2] = ay.fir;
+  ayumi_sample y[2];
+  double start = now();
+  if (stage == STAGE_DECIMATE) {
+    for (i = 0; i < frames; i += 1) {
+      ay.decimate((const ayumi_sample (*)[2]) &fir[(i * DECIMATE_FACTOR) % FIR_SIZE], y);
+      ay.left += y[0];
+    }
+    return now() - start;
+  }
+  if (stage == STAGE_DC_FILTER) {
+    for (i = 0; i < frames; i += 1) {
+      ay.left = ay.right = i & 64 ? 0.5 : -0.25;
+      ayumi_remove_dc(&ay);
+    }
+    return now() - start;
+  }
+  for (i = 0; i < frames; i += n) {
+    n = frames - i < BLOCK_SIZE ? frames - i : BLOCK_SIZE;
+    n = frame_size - i % frame_size < n ? frame_size - i % frame_size : n;
+    if (i % frame_size == 0) {
+      write_pattern(&ay, pattern, frame);
+      frame += 1;
+    }
+    if (stage == STAGE_STEMS) {
+      ayumi_process_stems(&ay, &stems, outputs, left, right, n, 1);
+    } else {
+      ayumi_process_block(&ay, left, right, n,
+        stage == STAGE_PROCESS || stage == STAGE_MONO || stage == STAGE_BLEP);
+    }
+  }
+  return now() - start;
+}
+
+/* Block by block over many chips, the cache footprint of a chip matters */
+static double run_instances(int pattern, int frames, int sr) {
+  int i, c, n, frame = 0;
+  int frame_size = sr / 50;
+  double start = now();
+  for (i = 0; i < frames; i += n) {
+    n = frames - i < BLOCK_SIZE ? frames - i : BLOCK_SIZE;
+    n = frame_size - i % frame_size < n ? frame_size - i % frame_size : n;
+    for (c = 0; c < INSTANCES; c += 1) {
+      if (i % frame_size == 0) {
+        write_pattern(&chips[c], pattern, frame);
+      }
+      ayumi_process_block(&chips[c], left, right, n, 1);
+    }
+    frame += i % frame_size == 0;
+  }
+  return now() - start;
+}
+
+/*
+ * Renders one case of the accuracy test, random register writes to a
+ * 2 MHz YM2149, and writes it to out or compares it with reference.
+ * Returns 0 when the reference ends early.
+ */
+static int run_accuracy(int simd, int test, FILE* out, FILE* reference, double* max, double* squares) {
+  float frames[BLOCK_SIZE * 2];
+  float expected[BLOCK_SIZE * 2];
+  int total = ACCURACY_SECONDS * ACCURACY_RATE;
+  int frame_size = ACCURACY_RATE / 50;
+  int i, j, n, frame = 0;
+  double d;
+  seed = 1;
+  ayumi_configure(&ay, 1, 2000000, ACCURACY_RATE);
+  ayumi_set_simd(&ay, simd);
+  if (test == ACCURACY_BLEP) {
+    ayumi_set_engine(&ay, AYUMI_ENGINE_BLEP);
+  } else {
+    ayumi_set_quality(&ay, test);
+  }
+  for (j = 0; j < TONE_CHANNELS; j += 1) {
+    ayumi_set_pan(&ay, j, 0.25 * (j + 1), 0);
+  }
+  for (i = 0; i < total; i += n) {
+    n = total - i < BLOCK_SIZE ? total - i : BLOCK_SIZE;
+    n = frame_size - i % frame_size < n ? frame_size - i % frame_size : n;
+    if (i % frame_size == 0) {
+      write_pattern(&ay, PATTERN_BUSY, frame);
+      frame += 1;
+    }
+    ayumi_process_block(&ay, left, right, n, 1);
+    for (j = 0; j < n; j += 1) {
+      frames[j * 2] = left[j];
+      frames[j * 2 + 1] = right[j];
+    }
+    if (out) {
+      fwrite(frames, sizeof(float) * 2, n, out);
+    }
+    if (reference) {
+      if (fread(expected, sizeof(float) * 2, n, reference) != (size_t) n) {
+        return 0;
+      }
+      for (j = 0; j < n * 2; j += 1) {
+        d = fabs(frames[j] - expected[j]);
+        *max = d > *max ? d : *max;
+        *squares += d * d;
+      }
+    }
+  }
+  return 1;
+}
+
+/*
+ * Writes every case of the accuracy test to a raw file, or prints how far
+ * each one is from such a file, written by a build of another sample type.
+ */
+static int accuracy(int simd, const char* output, const char* reference) {
+  FILE* f = fopen(output ? output : reference, output ? "wb" : "rb");
+  double max, squares;
+  int test, ok = 1;
+  if (!f) {
+    fprintf(stderr, "%s: cannot %s file\n", output ? output : reference, output ? "create" : "read");
+    return 1;
+  }
+  for (test = 0; test < ACCURACY_CASES && ok; test += 1) {
+    max = 0;
+    squares = 0;
+    ok = run_accuracy(simd, test, output ? f : NULL, output ? NULL : f, &max, &squares);
+    if (ok && reference) {
+      printf("%-8s max %.1e rms %.1e\n", accuracy_names[test], max,
+        sqrt(squares / (2.0 * ACCURACY_SECONDS * ACCURACY_RATE)));
+    }
+  }
+  if (!ok) {
+    fprintf(stderr, "%s: too short for the accuracy test\n", reference);
+  }
+  if (fclose(f) && output) {
+    fprintf(stderr, "%s: cannot write file\n", output);
+    ok = 0;
+  }
+  return !ok;
+}
+
+static uint64_t sequence[1024];
+static char* uris[MAX_URIS];
+static int uri_count;
+
+static LV2_URID map_uri(LV2_URID_Map_Handle handle, const char* uri) {
+  int i;
+  for (i = 0; i < uri_count; i += 1) {
+    if (!strcmp(uris[i], uri)) {
+      return i + 1;
+    }
+  }
+  if (uri_count == MAX_URIS) {
+    return 0;
+  }
+  uris[uri_count] = strdup(uri);
+  uri_count += 1;
+  return uri_count;
+}
+
+static void add_midi(LV2_Atom_Sequence* seq, LV2_URID midi, int b0, int b1, int b2) {
+  LV2_Atom_Event* ev = (LV2_Atom_Event*) ((uint8_t*) sequence + sizeof(LV2_Atom) + seq->atom.size);
+  uint8_t* msg = (uint8_t*) (ev + 1);
+  ev->time.frames = 0;
+  ev->body.type = midi;
+  ev->body.size = 3;
+  msg[0] = b0;
+  msg[1] = b1;
+  msg[2] = b2;
+  seq->atom.size += sizeof(LV2_Atom_Event) + 8;
+}
+
+/* MIDI of one block, the plugin counterpart of write_pattern */
+static void fill_sequence(LV2_Atom_Sequence* seq, LV2_URID midi, int pattern, int block) {
+  int i;
+  seq->atom.size = sizeof(LV2_Atom_Sequence_Body);
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    if (pattern == PATTERN_BUSY || block == 0) {
+      if (pattern == PATTERN_ENVELOPE) {
+        add_midi(seq, midi, 0xb0 | i, 0x13, 10);
+      } else if (pattern == PATTERN_BUSY) {
+        add_midi(seq, midi, 0x80 | i, 0, 0);
+        add_midi(seq, midi, 0xb0 | i, 0x0a, random_int(128));
+      }
+      add_midi(seq, midi, 0x90 | i, 40 + random_int(48), 100);
+    }
+  }
+}
+
+static double run_plugin(const LV2_Descriptor* plugin, int pattern, int frames, int sr) {
+  LV2_URID_Map map = {NULL, map_uri};
+  LV2_Feature map_feature = {LV2_URID__map, &map};
+  const LV2_Feature* features[] = {&map_feature, NULL};
+  LV2_Atom_Sequence* seq = (LV2_Atom_Sequence*) sequence;
+  LV2_URID midi = map_uri(NULL, LV2_MIDI__MidiEvent);
+  LV2_Handle handle = plugin->instantiate(plugin, sr, ".", features);
+  float chips = 1;
+  double start, elapsed = 0;
+  int i, n;
+  seq->atom.type = map_uri(NULL, LV2_ATOM__Sequence);
+  seq->body.unit = 0;
+  seq->body.pad = 0;
+  plugin->connect_port(handle, 0, seq);
+  plugin->connect_port(handle, 1, left);
+  plugin->connect_port(handle, 2, right);
+  plugin->connect_port(handle, 3, &chips);
+  plugin->activate(handle);
+  for (i = 0; i < frames; i += n) {
+    n = frames - i < BLOCK_SIZE ? frames - i : BLOCK_SIZE;
+    fill_sequence(seq, midi, pattern, i / BLOCK_SIZE);
+    start = now();
+    plugin->run(handle, n);
+    elapsed += now() - start;
+  }
+  plugin->deactivate(handle);
+  plugin->cleanup(handle);
+  return elapsed;
+}
+
+static void measure(struct bench* b, int stage, double clock_rate, int sr, int is_ym, int pattern) {
+  struct result* r = &b->results[b->count];
+  int frames = b->seconds * sr;
+  int i, j;
+  double t, best = 1e30;
+  for (i = 0; i < REPEATS; i += 1) {
+    seed = 1;
+    if (stage == STAGE_LV2_RUN) {
+      t = run_plugin(b->plugin, pattern, frames, sr);
+    } else if (stage == STAGE_INSTANCES) {
+      for (j = 0; j < INSTANCES; j += 1) {
+        ayumi_configure(&chips[j], is_ym, clock_rate, sr);
+        ayumi_set_simd(&chips[j], b->simd);
+      }
+      t = run_instances(pattern, frames / INSTANCES, sr);
+    } else {
+      ayumi_configure(&ay, is_ym, clock_rate, sr);
+      ayumi_set_simd(&ay, b->simd);
+      for (j = 0; j < TONE_CHANNELS; j += 1) {
+        ayumi_set_pan(&ay, j, stage == STAGE_MONO ? 0.5 : 0.25 * (j + 1), 0);
+      }
+      if (stage == STAGE_TICK) {
+        ay.decimate = null_decimate;
+      }
+      if (stage == STAGE_BLEP) {
+        ayumi_set_engine(&ay, AYUMI_ENGINE_BLEP);
+      }
+      if (stage == STAGE_STEMS) {
+        ayumi_stems_configure(&stems, &ay);
+      }
+      t = run_core(stage, pattern, frames, sr);
+    }
+    best = t < best ? t : best;
+  }
+  snprintf(r->stage, sizeof(r->stage), "%s", stage_names[stage]);
+  r->clock_rate = clock_rate;
+  r->sample_rate = sr;
+  snprintf(r->dac, sizeof(r->dac), "%s", is_ym ? "ym" : "ay");
+  snprintf(r->pattern, sizeof(r->pattern), "%s", pattern_names[pattern]);
+  r->ns_per_frame = best * 1e9 / frames;
+  r->realtime = frames / (best * sr);
+  b->count += 1;
+}
+
+static void run_all(struct bench* b) {
+  int stage, c, s, is_ym, pattern;
+  for (stage = 0; stage < STAGE_COUNT; stage += 1) {
+    for (c = 0; c < 2; c += 1) {
+      for (s = 0; s < 4; s += 1) {
+        for (is_ym = 0; is_ym < 2; is_ym += 1) {
+          for (pattern = 0; pattern < PATTERN_COUNT; pattern += 1) {
+            /* the plugin runs a 2 MHz YM2149, filters do not see registers */
+            if (stage == STAGE_LV2_RUN && (!b->plugin || c == 0 || !is_ym)) {
+              continue;
+            }
+            if ((stage == STAGE_DECIMATE || stage == STAGE_DC_FILTER) && pattern > 0) {
+              continue;
+            }
+            measure(b, stage, clock_rates[c], sample_rates[s], is_ym, pattern);
+          }
+        }
+      }
+    }
+  }
+}
+
+static void write_json(FILE* f, struct bench* b) {
+  int i;
+  struct result* r;
+  fprintf(f, "{\n  \"simd\": %d,\n  \"seconds\": %g,\n  \"results\": [\n", b->simd, b->seconds);
+  for (i = 0; i < b->count; i += 1) {
+    r = &b->results[i];
+    fprintf(f, "    {\"stage\": \"%s\", \"clock\": %d, \"sample_rate\": %d, \"dac\": \"%s\", "
+      "\"pattern\": \"%s\", \"ns_per_frame\": %.3f, \"realtime\": %.1f}%s\n",
+      r->stage, r->clock_rate, r->sample_rate, r->dac, r->pattern, r->ns_per_frame,
+      r->realtime, i + 1 < b->count ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+}
+
+/* Reads the results of write_json, one result per line */
+static int read_json(const char* path, struct result* results) {
+  char line[512];
+  int count = 0;
+  struct result* r;
+  FILE* f = fopen(path, "r");
+  if (!f) {
+    return -1;
+  }
+  while (count < MAX_RESULTS && fgets(line, sizeof(line), f)) {
+    r = &results[count];
+    if (sscanf(line, " {\"stage\": \"%15[^\"]\", \"clock\": %d, \"sample_rate\": %d, \"dac\": \"%3[^\"]\", "
+        "\"pattern\": \"%15[^\"]\", \"ns_per_frame\": %lf, \"realtime\": %lf", r->stage,
+        &r->clock_rate, &r->sample_rate, r->dac, r->pattern, &r->ns_per_frame, &r->realtime) == 7) {
+      count += 1;
+    }
+  }
+  fclose(f);
+  return count;
+}
+
+/*
+ * Prints the change against a baseline, returns the number of regressions
+ * and of results the baseline has no entry for
+ */
+static int compare(struct bench* b, struct result* base, int base_count, double tolerance) {
+  int i, j, regressions = 0, missing = 0;
+  double ratio;
+  struct result* r;
+  for (i = 0; i < b->count; i += 1) {
+    r = &b->results[i];
+    for (j = 0; j < base_count; j += 1) {
+      if (!strcmp(r->stage, base[j].stage) && r->clock_rate == base[j].clock_rate
+        && r->sample_rate == base[j].sample_rate && !strcmp(r->dac, base[j].dac)
+        && !strcmp(r->pattern, base[j].pattern)) {
+        break;
+      }
+    }
+    if (j == base_count) {
+      missing += 1;
+      fprintf(stderr, "%-9s %7d %6d %s %-8s %9s -> %9.2f ns/frame          NO BASELINE\n", r->stage,
+        r->clock_rate, r->sample_rate, r->dac, r->pattern, "", r->ns_per_frame);
+      continue;
+    }
+    ratio = r->ns_per_frame / base[j].ns_per_frame;
+    if (ratio > 1 + tolerance) {
+      regressions += 1;
+    }
+    fprintf(stderr, "%-9s %7d %6d %s %-8s %9.2f -> %9.2f ns/frame %+6.1f%%%s\n", r->stage,
+      r->clock_rate, r->sample_rate, r->dac, r->pattern, base[j].ns_per_frame, r->ns_per_frame,
+      (ratio - 1) * 100, ratio > 1 + tolerance ? "  REGRESSION" : "");
+  }
+  if (missing) {
+    fprintf(stderr, "%d results have no baseline, regenerate it with -o\n", missing);
+  }
+  return regressions + missing;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr,
+    "Usage: %s [options]\n"
+    "  -o file     write JSON results to file instead of stdout\n"
+    "  -c file     compare against a baseline written by -o\n"
+    "  -t percent  slowdown reported as a regression (10)\n"
+    "  -d seconds  audio rendered per measurement (1)\n"
+    "  -s simd     decimator: auto, scalar, sse2, avx2, avx512, neon\n"
+    "  -p plugin   ayumi-lv2.so to measure the lv2_run stage\n"
+    "  -r file     write the output of the accuracy test to file instead\n"
+    "  -e file     compare the output of the accuracy test with file instead\n", name);
+}
+
+int main(int argc, char** argv) {
+  static struct bench b;
+  static struct result base[MAX_RESULTS];
+  static const char* simd_names[] = {"auto", "scalar", "sse2", "avx2", "avx512", "neon"};
+  const char* output = NULL;
+  const char* baseline = NULL;
+  const char* accuracy_output = NULL;
+  const char* accuracy_reference = NULL;
+  double tolerance = 0.1;
+  void* library;
+  LV2_Descriptor_Function descriptor;
+  FILE* f = stdout;
+  int opt, i, base_count = 0;
+  b.seconds = 1;
+  while ((opt = getopt(argc, argv, "o:c:t:d:s:p:r:e:")) != -1) {
+    switch (opt) {
+    case 'o':
+      output = optarg;
+      break;
+    case 'c':
+      baseline = optarg;
+      break;
+    case 't':
+      tolerance = atof(optarg) / 100;
+      break;
+    case 'd':
+      b.seconds = atof(optarg);
+      break;
+    case 's':
+      for (i = 0; i < 6 && strcmp(optarg, simd_names[i]); i += 1) {
+      }
+      b.simd = i < 6 ? i : AYUMI_SIMD_AUTO;
+      break;
+    case 'p':
+      library = dlopen(optarg, RTLD_NOW);
+      descriptor = library ? (LV2_Descriptor_Function) dlsym(library, "lv2_descriptor") : NULL;
+      b.plugin = descriptor ? descriptor(0) : NULL;
+      if (!b.plugin) {
+        fprintf(stderr, "%s: cannot load plugin\n", optarg);
+        return 1;
+      }
+      break;
+    case 'r':
+      accuracy_output = optarg;
+      break;
+    case 'e':
+      accuracy_reference = optarg;
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (baseline && (base_count = read_json(baseline, base)) < 0) {
+    fprintf(stderr, "%s: cannot read baseline\n", baseline);
+    return 1;
+  }
+  b.simd = ayumi_set_simd(&ay, b.simd);
+  if (accuracy_output || accuracy_reference) {
+    return accuracy(b.simd, accuracy_output, accuracy_reference);
+  }
+  run_all(&b);
+  if (output && !(f = fopen(output, "w"))) {
+    fprintf(stderr, "%s: cannot create file\n", output);
+    return 1;
+  }
+  write_json(f, &b);
+  if (f != stdout) {
+    fclose(f);
+  }
+  return baseline && compare(&b, base, base_count, tolerance) > 0;
+}
@@ -0,0 +1,658 @@
+/*
+ * Band-limited step for BLEP_PHASES + 1 phases, included with TAP defined.
+ * Row q holds the differences of a windowed sinc step (Kaiser beta 8,
+ * cutoff 0.45 of the output rate) over BLEP_TAPS output samples, for a
+ * transition q / BLEP_PHASES of a sample before the frame. Each row sums
+ * to 1, the step is delayed by BLEP_TAPS / 2 samples.
+ */
+
+  {
+    TAP(0.0), TAP(0.0), TAP(2.0938431772476102e-05), TAP(6.087467239282313e-05),
+    TAP(-0.0003822582222015794), TAP(0.0011369752845100472), TAP(-0.0024883477312543645), TAP(0.004448352603680179),
+    TAP(-0.006736020744133467), TAP(0.008656891845321122), TAP(-0.009041599004047392), TAP(0.0062448709130871905),
+    TAP(0.0018879308537611654), TAP(-0.01843222170795525), TAP(0.04953995773025619), TAP(-0.11709758637580064),
+    TAP(0.5821812414506113), TAP(0.5821812414506119), TAP(-0.11709758637580078), TAP(0.04953995773025614),
+    TAP(-0.018432221707955262), TAP(0.0018879308537611682), TAP(0.006244870913087185), TAP(-0.009041599004047373),
+    TAP(0.008656891845321113), TAP(-0.00673602074413347), TAP(0.004448352603680177), TAP(-0.0024883477312543645),
+    TAP(0.0011369752845100476), TAP(-0.00038225822220157936), TAP(6.087467239282317e-05), TAP(2.0938431772476125e-05),
+  },
+  {
+    TAP(0.0), TAP(-7.239969308893842e-07), TAP(2.519816810771368e-05), TAP(4.90356118545018e-05),
+    TAP(-0.00036050162643769316), TAP(0.0011093570120827966), TAP(-0.002472503680709819), TAP(0.004482886038419299),
+    TAP(-0.006885242536182185), TAP(0.009009729265152337), TAP(-0.00970248075112602), TAP(0.007316636976559964),
+    TAP(0.0003260782335328834), TAP(-0.016345766527195105), TAP(0.04694995409751569), TAP(-0.11405568696532917),
+    TAP(0.5946146366775217), TAP(0.569517940665989), TAP(-0.1198143450218709), TAP(0.051989883246842346),
+    TAP(-0.020455423591386142), TAP(0.0034275662578653566), TAP(0.005173370536845907), TAP(-0.008370907600884167),
+    TAP(0.008291511253493542), TAP(-0.006575548976264604), TAP(0.004405504352534211), TAP(-0.0024989315341470714),
+    TAP(0.0011617381632126724), TAP(-0.0004027084598396148), TAP(7.222791833529229e-05), TAP(1.7516792437992127e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.5381306556177236e-06), TAP(2.9657775762621765e-05), TAP(3.672322255957535e-05),
+    TAP(-0.000337454358573271), TAP(0.0010788834845221694), TAP(-0.0024513391621118845), TAP(0.0045089033199954415),
+    TAP(-0.007022751604043259), TAP(0.009349147698782735), TAP(-0.010352105378412425), TAP(0.008386528134325458),
+    TAP(-0.0012551446449665961), TAP(-0.014199377631234715), TAP(0.044222714068291855), TAP(-0.11068542731022388),
+    TAP(0.6068045325245336), TAP(0.5566385307349593), TAP(-0.12220958121640708), TAP(0.054297194951369615),
+    TAP(-0.022412217538903257), TAP(0.004942214760705734), TAP(0.004104250865463392), TAP(-0.007691856054654398),
+    TAP(0.00791447721256846), TAP(-0.006404306269806725), TAP(0.00435455649266804), TAP(-0.0025043251457338915),
+    TAP(0.0011836515303391836), TAP(-0.00042183985832502116), TAP(8.308434049231133e-05), TAP(1.4213186712503254e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.376494811232878e-06), TAP(3.4246548490833065e-05), TAP(2.3951477090341932e-05),
+    TAP(-0.0003131353471583389), TAP(0.0010455609789032456), TAP(-0.0024248040886852705), TAP(0.004526217617578063),
+    TAP(-0.007148102671882322), TAP(0.009674287210153851), TAP(-0.010989030426245749), TAP(0.009452382206367606),
+    TAP(-0.0028528182633385554), TAP(-0.011996535242137866), TAP(0.041361384896700486), TAP(-0.10698399559844458),
+    TAP(0.6187375564035915), TAP(0.5435569917775541), TAP(-0.12428730273622715), TAP(0.05645966313749243),
+    TAP(-0.02429961779835819), TAP(0.00642918845806279), TAP(0.003039597449218815), TAP(-0.007005893003803755),
+    TAP(0.007526691381209312), TAP(-0.0062227867498172934), TAP(0.004295737448283404), TAP(-0.002504608144697524),
+    TAP(0.0012027271601315374), TAP(-0.00043964309764802045), TAP(9.343439290332239e-05), TAP(1.1031119524308999e-05),
+  },
+  {
+    TAP(0.0), TAP(-3.2376507367720133e-06), TAP(3.895781216872449e-05), TAP(1.0735841431405217e-05),
+    TAP(-0.00028756679411327715), TAP(0.0010094020171591118), TAP(-0.0023928587881239336), TAP(0.004534657220192004),
+    TAP(-0.007260869099979873), TAP(0.009984305703210537), TAP(-0.011611821418943192), TAP(0.010512019503117694),
+    TAP(-0.004463955451818277), TAP(-0.00974087556156767), TAP(0.03836941835413264), TAP(-0.10294899597100499),
+    TAP(0.6304005753416345), TAP(0.5302874685358425), TAP(-0.12605189693863134), TAP(0.05847536353587812),
+    TAP(-0.026114811082923378), TAP(0.0078858855244033), TAP(0.001981462581845165), TAP(-0.006314463324708752),
+    TAP(0.007129065381509524), TAP(-0.006031498413495452), TAP(0.004229288187924041), TAP(-0.00249986930345711),
+    TAP(0.0012189825798602726), TAP(-0.00045611196861464784), TAP(0.00010326997620177686), TAP(7.97367160757623e-06),
+  },
+  {
+    TAP(0.0), TAP(-4.120003401540942e-06), TAP(4.378430061140742e-05), TAP(-2.9067219059162476e-06),
+    TAP(-0.00026077419868004065), TAP(0.0009704254606348856), TAP(-0.0023554742657044547), TAP(0.004534066127958227),
+    TAP(-0.0073606440255113694), TAP(0.010278380872012742), TAP(-0.01221905486415023), TAP(0.01156324698510741),
+    TAP(-0.006085506488061118), TAP(-0.007436185758421833), TAP(0.03525056918079928), TAP(-0.09857845623937327),
+    TAP(0.6417807140689084), TAP(0.5168442511102963), TAP(-0.12750812038222945), TAP(0.06034267624936305),
+    TAP(-0.02785515978338587), TAP(0.009309794294199886), TAP(0.000931861620534343), TAP(-0.005619005285960817),
+    TAP(0.00672251883127539), TAP(-0.0058309619025650825), TAP(0.004155461536221165), TAP(-0.0024902062455260253),
+    TAP(0.0012324409208394871), TAP(-0.0004712433166714008), TAP(0.00011258441788390396), TAP(5.043504902913616e-06),
+  },
+  {
+    TAP(0.0), TAP(-5.021800572438811e-06), TAP(4.871815578608353e-05), TAP(-1.695775438808342e-05),
+    TAP(-0.00023278637427707978), TAP(0.0009286565923900795), TAP(-0.0023126324488037444), TAP(0.004524304619047048),
+    TAP(-0.007447041477823981), TAP(0.010555712134924025), TAP(-0.012809321265727753), TAP(0.012603862497344655),
+    TAP(-0.007714364377679897), TAP(-0.005086398609835667), TAP(0.03200889300344865), TAP(-0.09387083501948575),
+    TAP(0.6528653727867336), TAP(0.5032417555487818), TAP(-0.1286610879718459), TAP(0.0620602841826895),
+    TAP(-0.02951820481196797), TAP(0.010698497121280333), TAP(-0.00010723057877648667), TAP(-0.004920947749680223),
+    TAP(0.0063079773848902215), TAP(-0.005621709266429808), TAP(0.004074521471243744), TAP(-0.0024757250897938623),
+    TAP(0.0012431307600333273), TAP(-0.0004850369800102215), TAP(0.00012137244960452348), TAP(2.242868901421273e-06),
+  },
+  {
+    TAP(0.0), TAP(-5.9411324651708585e-06), TAP(5.375092969601191e-05), TAP(-3.139730567977503e-05),
+    TAP(-0.0002036354580688162), TAP(0.0008841271868378455), TAP(-0.002264326411982065), TAP(0.004505249790774289),
+    TAP(-0.007519697465526186), TAP(0.010815522548680751), TAP(-0.013381228144198494), TAP(0.013631659070775442),
+    TAP(-0.00934737030824101), TAP(-0.0026955868016477038), TAP(0.028648743717621234), TAP(-0.08882502826731503),
+    TAP(0.6636422445871936), TAP(0.4894945043179197), TAP(-0.1295162616479485), TAP(0.0636271709745193),
+    TAP(-0.031101668076492013), TAP(0.012049674011170729), TAP(-0.0011338831050541217), TAP(-0.004221707424953616),
+    TAP(0.005886370786657483), TAP(-0.005404282718787523), TAP(0.0039867424091460215), TAP(-0.0024565400827116298),
+    TAP(0.0012510859527775878), TAP(-0.0004974957222165519), TAP(0.000129630181627756), TAP(-4.2639210968894814e-07),
+  },
+  {
+    TAP(0.0), TAP(-6.875931894794412e-06), TAP(5.887358797646172e-05), TAP(-4.620394165991202e-05),
+    TAP(-0.0001733569130739629), TAP(0.0008368755663309895), TAP(-0.002210560581821607), TAP(0.004476796073303703),
+    TAP(-0.0075782710327302605), TAP(0.011057060698136148), TAP(-0.013933403058691035), TAP(0.014644429282977014),
+    TAP(-0.010981319268000235), TAP(-0.0002679568951150669), TAP(0.025174770333723506), TAP(-0.08344037520183467),
+    TAP(0.6740993324977156), TAP(0.4756171066866724), TAP(-0.13007943864167573), TAP(0.06504261844021804),
+    TAP(-0.0326034545844017), TAP(0.013361106021888948), TAP(-0.002146212309274956), TAP(-0.003522686178324906),
+    TAP(0.005458630940447261), TAP(-0.0051792333903702675), TAP(0.0038924084778071645), TAP(-0.0024327732193697832),
+    TAP(0.0012563454571505352), TAP(-0.0005086251597306564), TAP(0.00013735507456466908), TAP(-2.962830943164711e-06),
+  },
+  {
+    TAP(0.0), TAP(-7.823974939933987e-06), TAP(6.407651524031401e-05), TAP(-6.135475630515537e-05),
+    TAP(-0.0001419895226510877), TAP(0.0007869466443272559), TAP(-0.0021513509207424252), TAP(0.00443885571445556),
+    TAP(-0.0076224452818176745), TAP(0.011279602557472481), TAP(-0.01446449662424679), TAP(0.015639969670022333),
+    TAP(-0.012612965820246139), TAP(0.002192157032647756), TAP(0.021591913287125588), TAP(-0.07771666360214455),
+    TAP(0.6842249661240591), TAP(0.4616242390520957), TAP(-0.13035673931712502), TAP(0.06630620353468078),
+    TAP(-0.034021654176842164), TAP(0.014630678429141493), TAP(-0.00314238498981902), TAP(-0.0028252684060972367),
+    TAP(0.005025689999390099), TAP(-0.0049471200804478985), TAP(0.0037918127811567446), TAP(-0.0024045538544669805),
+    TAP(0.001258953150536215), TAP(-0.0005184336843990896), TAP(0.00014454590853366545), TAP(-5.365388593951028e-06),
+  },
+  {
+    TAP(0.0), TAP(-8.782882133822404e-06), TAP(6.934952220707477e-05), TAP(-7.682538750465342e-05),
+    TAP(-0.00010957537721459374), TAP(0.0007343919547902298), TAP(-0.0020867250890513125), TAP(0.004391359234161713),
+    TAP(-0.007651928360133096), TAP(0.011482453318682237), TAP(-0.01497318551829439), TAP(0.016616085181265332),
+    TAP(-0.014239030023718617), TAP(0.004680300066354683), TAP(0.017905400213419177), TAP(-0.07165413446647881),
+    TAP(0.6940078178658259), TAP(0.4475306252372088), TAP(-0.13035459462311336), TAP(0.06741779484522505),
+    TAP(-0.03535454289368343), TAP(0.015856383652375888), TAP(-0.004120621441302786), TAP(-0.002130818473024053),
+    TAP(0.004588478479275035), TAP(-0.004708508009701662), TAP(0.003685256655874933), TAP(-0.002372018304173385),
+    TAP(0.0012589576389312217), TAP(-0.0005269323813990713), TAP(0.00015120274988275972), TAP(-7.63338455313479e-06),
+  },
+  {
+    TAP(0.0), TAP(-9.750120194078148e-06), TAP(7.468185464497217e-05), TAP(-9.259003686137304e-05),
+    TAP(-7.615985304969719e-05), TAP(0.0006792696675072494), TAP(-0.0020167225845151276), TAP(0.004334255847151579),
+    TAP(-0.007666454408054658), TAP(0.011664949183135806), TAP(-0.01545817547004697), TAP(0.017570593668620054),
+    TAP(-0.01585620348918522), TAP(0.007191903439536634), TAP(0.014120741190906401), TAP(-0.06525348602179237),
+    TAP(0.7034369186792415), TAP(0.4333510167909155), TAP(-0.1300797331771317), TAP(0.068377548625308),
+    TAP(-0.03660058397104753), TAP(0.017036323938641868), TAP(-0.005079198362325964), TAP(-0.0014406782217801185),
+    TAP(0.004147923399215053), TAP(-0.0044639675770362045), TAP(0.003573048922147978), TAP(-0.002335309439895997),
+    TAP(0.0012564120595523179), TAP(-0.0005341349428236561), TAP(0.000157326915615812), TAP(-9.766506400058269e-06),
+  },
+  {
+    TAP(0.0), TAP(-1.0723004301816621e-05), TAP(8.00622041515434e-05), TAP(-0.00010862149352657759),
+    TAP(-4.179158311100079e-05), TAP(0.0006216445890319182), TAP(-0.0019413948587881688), TAP(0.004267513852501223),
+    TAP(-0.007665784465935739), TAP(0.011826459112078564), TAP(-0.015918204226540753), TAP(0.01850133040174511),
+    TAP(-0.017461155561887386), TAP(0.009722291821351911), TAP(0.010243723453329563), TAP(-0.05851587707362431),
+    TAP(0.712501673362631), TAP(0.419100173319824), TAP(-0.12953916800468002), TAP(0.06918590438053092),
+    TAP(-0.037758428473564226), TAP(0.01816871380171654), TAP(-0.006016451617937455), TAP(-0.0007561645574094587),
+    TAP(0.0037049464530432338), TAP(-0.004214073122856106), TAP(0.0034555051301475943), TAP(-0.0022945762749548492),
+    TAP(0.00125137387730721), TAP(-0.0005400575772198915), TAP(0.00016292093566728198), TAP(-1.1764798719837683e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.1698700939317473e-05), TAP(8.547872079368073e-05), TAP(-0.00012489116210494453),
+    TAP(-6.522419705873782e-06), TAP(0.0005615881489861455), TAP(-0.0018608054100633514), TAP(0.004191120988729265),
+    TAP(-0.007649707337467387), TAP(0.011966386531934884), TAP(-0.01635204448900952), TAP(0.019406152600399698),
+    TAP(-0.019050539619215334), TAP(0.01226669089308914), TAP(0.006280405576791338), TAP(-0.05144292968696097),
+    TAP(0.7211918753407414), TAP(0.40479284288170003), TAP(-0.12874018295759848), TAP(0.06984358001907635),
+    TAP(-0.038826915564237126), TAP(0.019251882214450566), TAP(-0.00693077885296085), TAP(-7.85671107469291e-05),
+    TAP(0.0032604622147971098), TAP(-0.003959401701286031), TAP(0.0033329468038877457), TAP(-0.002249973545178061),
+    TAP(0.0012439046756944933), TAP(-0.0005447189153757408), TAP(0.00016798851317215063), TAP(-1.3628651394155758e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.2674231294033355e-05), TAP(9.091902762350266e-05), TAP(-0.00014136909465844677),
+    TAP(2.9592611019009214e-05), TAP(0.0004991783714850434), TAP(-0.0017750298513591123), TAP(0.004105084753178257),
+    TAP(-0.007618040407069959), TAP(0.012084170990339885), TAP(-0.01675850681327733), TAP(0.020282943975106747),
+    TAP(-0.02062099947263338), TAP(0.014820235203599602), TAP(0.0022371111457544857), TAP(-0.044036731189861754),
+    TAP(0.729497720924815), TAP(0.39044374247010266), TAP(-0.1276903188353916), TAP(0.07035156657937529),
+    TAP(-0.039805072415444405), TAP(0.020284274552792872), TAP(-0.007820641952659125), TAP(0.0005908540153959655),
+    TAP(0.0028153763815370225), TAP(-0.003700531863761505), TAP(0.003205700684093612), TAP(-0.0022016612844206656),
+    TAP(0.001234069942700986), TAP(-0.0005481399126543026), TAP(0.00017253448287931586), TAP(-1.5358787313685696e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.3646475235231406e-05), TAP(9.637023708166515e-05), TAP(-0.0001580240268274908),
+    TAP(6.64953628519154e-05), TAP(0.00043449983147743213), TAP(-0.0016841559538981047), TAP(0.004009432684478799),
+    TAP(-0.007570630408988084), TAP(0.012179289758872372), TAP(-0.01713644246785332), TAP(0.021129619267145735),
+    TAP(-0.022169175862558857), TAP(0.01737797629227409), TAP(-0.001879578096051943), TAP(-0.03629983549267641),
+    TAP(0.7374098230261232), TAP(0.3760675386195381), TAP(-0.12639735923388637), TAP(0.07071112254843034),
+    TAP(-0.04069211376523116), TAP(0.02126445429045032), TAP(-0.008684569347560641), TAP(0.0012508704137019994),
+    TAP(0.0023705840566275896), TAP(-0.003438042456361397), TAP(0.0030740979716957773), TAP(-0.0021498043960068965),
+    TAP(0.0012219388522656746), TAP(-0.0005503437481758966), TAP(0.00017656476785802365), TAP(-1.6956249560852416e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.4612175868009104e-05), TAP(0.00010181896929482712), TAP(-0.0001748234180779093),
+    TAP(0.00010412463159688002), TAP(0.0003676435958251274), TAP(-0.0015882836650797571), TAP(0.0039042126069554397),
+    TAP(-0.007507354145834137), TAP(0.012251259378523702), TAP(-0.017484746243426146), TAP(0.021944128778800708),
+    TAP(-0.0236917130345974), TAP(0.01993489106757507), TAP(-0.006062829603058543), TAP(-0.028235263716755304),
+    TAP(0.7449192243014979), TAP(0.3616788281601937), TAP(-0.12486931614586015), TAP(0.07092376778481668),
+    TAP(-0.041487441123666965), TAP(0.022191104443634), TAP(-0.009521158159614046), TAP(0.0019002874501132842),
+    TAP(0.0019269680764892232), TAP(-0.003172511433192506), TAP(0.002938473573537607), TAP(-0.002094572221088286),
+    TAP(0.0012075840418790903), TAP(-0.0005513557211498417), TAP(0.00018008633464774), TAP(-1.8422388111846454e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.5567944667825625e-05), TAP(0.00010725137226895589), TAP(-0.0001917334960722905),
+    TAP(0.00014241622548825386), TAP(0.0002987071489755194), TAP(-0.0014875251005966265), TAP(0.0037894928358989505),
+    TAP(-0.007428119154402582), TAP(0.012299637144008203), TAP(-0.017802359207483062), TAP(0.02272446288470955),
+    TAP(-0.025185265385257196), TAP(0.022485890428546106), TAP(-0.01030556788592366), TAP(-0.019846504127654034),
+    TAP(0.7520174097102859), TAP(0.34729211915099945), TAP(-0.12311441533853289), TAP(0.07099127706095255),
+    TAP(-0.04219064163464642), TAP(0.02306302876583596), TAP(-0.010329076187186894), TAP(0.00253794624874865),
+    TAP(0.00148539738370006), TAP(-0.0029045146880722138), TAP(0.0027991653518558584), TAP(-0.0020361381049005126),
+    TAP(0.0011910813868853396), TAP(-0.0005512031446582891), TAP(0.00018310714700231698), TAP(-1.9758846106879712e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.651026719704017e-05), TAP(0.00011265314397499955), TAP(-0.00020871930515378254),
+    TAP(0.00018130304394708123), TAP(0.0002277943031141371), TAP(-0.0013820045102939861), TAP(0.0036653623426977635),
+    TAP(-0.007332864316659643), TAP(0.01232402252309962), TAP(-0.01808827139781826), TAP(0.023468656515097705),
+    TAP(-0.026646504165003443), TAP(0.025025828116149822), TAP(-0.014600482861631799), TAP(-0.011137511368932628),
+    TAP(0.7586963184630362), TAP(0.3329218120193944), TAP(-0.1211410815330247), TAP(0.0709156732397664),
+    TAP(-0.04280148659909647), TAP(0.023879152693066164), TAP(-0.011107063726771284), TAP(0.0031627255810563006),
+    TAP(0.0010467254491973652), TAP(-0.0026346249066866423), TAP(0.0026565133790633993), TAP(-0.001974678961890486),
+    TAP(0.0011725097720510353), TAP(-0.0005499152371942462), TAP(0.0001856361183793553), TAP(-2.0967545737611485e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.7435509403255758e-05), TAP(0.00011800955631819178), TAP(-0.0002257447589199945),
+    TAP(0.00022071516466797375), TAP(0.00015501509271693587), TAP(-0.0012718582174233945), TAP(0.0035319308788932945),
+    TAP(-0.007221560413901222), TAP(0.012324058507266982), TAP(-0.018341524448749147), TAP(0.024174793601636126),
+    TAP(-0.028072124226275696), TAP(0.027549509780734983), TAP(-0.01894003868609652), TAP(-0.002112704993773089),
+    TAP(0.7649483553431943), TAP(0.31858218093578), TAP(-0.1189579234110533), TAP(0.07069922010139704),
+    TAP(-0.04331992966612663), TAP(0.024638524040461372), TAP(-0.011853935229609149), TAP(0.0037735436565128747),
+    TAP(0.0006117887461923556), TAP(-0.0023634104413297035), TAP(0.0025108591993293003), TAP(-0.0019103748406718165),
+    TAP(0.001151950860961311), TAP(-0.0005475230122550362), TAP(0.0001876830633253392), TAP(-2.2050673800483837e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.833992449753235e-05), TAP(0.00012330548097688447), TAP(-0.00024277269685391391),
+    TAP(0.00026057993900537), TAP(8.048565345577303e-05), TAP(-0.001157234530993657), TAP(0.0033893290582983795),
+    TAP(-0.0070942106221649915), TAP(0.012299432889979983), TAP(-0.01856121414392519), TAP(0.024841011476635613),
+    TAP(-0.02945885080387144), TAP(0.030051702251401437), TAP(-0.023316483058839956), TAP(0.0072230327072389374),
+    TAP(0.7707664013840263), TAP(0.30428735545016855), TAP(-0.11657371847426311), TAP(0.07034441483603593),
+    TAP(-0.04374610469920976), TAP(0.025340313451651213), TAP(-0.012568580791798418), TAP(0.004369359812410966),
+    TAP(0.00018140527827322612), TAP(-0.0020914342102527407), TAP(0.0023625450984147995), TAP(-0.0018434084897514694),
+    TAP(0.0011294888637976975), TAP(-0.0005440591662907897), TAP(0.0001892586479064058), TAP(-2.301066696438656e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.9219660408762622e-05), TAP(0.00012852541709135323), TAP(-0.00025976494496792845),
+    TAP(0.0003008220956079976), TAP(4.3280854449984e-06), TAP(-0.0010382936309769465), TAP(0.003237708396395695),
+    TAP(-0.006950850947081448), TAP(0.012249879469159983), TAP(-0.018746492889694214), TAP(0.025465505216282252),
+    TAP(-0.03080344631490423), TAP(0.0325271429925228), TAP(-0.027721856988429265), TAP(0.01686435958268578),
+    TAP(0.7761438238840203), TAP(0.29005130241805416), TAP(-0.11399739778166301), TAP(0.06985398021946382),
+    TAP(-0.04408032332501659), TAP(0.02598381460273398), TAP(-0.013249967476789727), TAP(0.004949176100510696),
+    TAP(-0.00024362683597124212), TAP(-0.0018192526235755848), TAP(0.002211913383184596), TAP(-0.00177396492495335),
+    TAP(0.0011052103040461642), TAP(-0.0005395579653052854), TAP(0.0001903743393335406), TAP(-2.385019680063194e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.0070767808700997e-05), TAP(0.00013365352077749203), TAP(-0.00027668238040607864),
+    TAP(0.0003413638522300084), TAP(-7.332969914787812e-05), TAP(-0.0009152074261833601), TAP(0.003077241306313391),
+    TAP(-0.00679155059645245), TAP(0.01217517917036717), TAP(-0.018896572103083906), TAP(0.026046531918628765),
+    TAP(-0.032102717165370984), TAP(0.034970549732199624), TAP(-0.03214800500647354), TAP(0.026805477200622513),
+    TAP(0.7810744857450224), TAP(0.2758878082419823), TAP(-0.11123803059068353), TAP(0.06923085648824384),
+    TAP(-0.04432307217304282), TAP(0.026568444163173034), TAP(-0.0138971404695297), TAP(0.00551203876856618),
+    TAP(-0.000662530719620731), TAP(-0.0015474145376278953), TAP(0.0020593056721712444), TAP(-0.001702230999445627),
+    TAP(0.0010792037846759752), TAP(-0.0005340551304034751), TAP(0.00019104235492955836), TAP(-2.4572154622658547e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.08892087003054e-05), TAP(0.00013867363643472466), TAP(-0.0002934849999386142),
+    TAP(0.0003821250356267077), TAP(-0.00015235414406886916), TAP(-0.0007881593846741316), TAP(0.0029081210507581005),
+    TAP(-0.006616412288954278), TAP(0.012075161087437123), TAP(-0.019010724508562407), TAP(0.02658241490708518),
+    TAP(-0.03335352055021287), TAP(0.037376630246952515), TAP(-0.03658658581712233), TAP(0.037040135130850915),
+    TAP(0.7855527541184297), TAP(0.2618104614547085), TAP(-0.10830480892735596), TAP(0.06847819293190766),
+    TAP(-0.04447500981466159), TAP(0.027093741516373733), TAP(-0.014509224061851123), TAP(0.006057039634974415),
+    TAP(-0.0010745520333466636), TAP(-0.0012764602395047273), TAP(0.0019050621985263311), TAP(-0.0016283949772580267),
+    TAP(0.0010515597543212527), TAP(-0.0005275877225764239), TAP(0.000191275610583452), TAP(-2.517963618220689e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.1670865560197776e-05), TAP(0.00014356932981182392), TAP(-0.00031013199227180796),
+    TAP(0.000423023209422067), TAP(-0.00023260623242691466), TAP(-0.0006573443366417004), TAP(0.0027305616493709947),
+    TAP(-0.006425572497475907), TAP(0.011949703437411294), TAP(-0.01908828633786114), TAP(0.02707154785019997),
+    TAP(-0.034552771233628425), TAP(0.03974009228652621), TAP(-0.04102908336816197), TAP(0.047561635926254515),
+    TAP(0.7895735083458512), TAP(0.2478326356692193), TAP(-0.10520703211106697), TAP(0.067599339219814),
+    TAP(-0.04453696341070947), TAP(0.027559368243140585), TAP(-0.015085422469051885), TAP(0.006583317355031704),
+    TAP(-0.0014789602087020297), TAP(-0.0010069204635329118), TAP(0.001749521126645979), TAP(-0.0015526461111531262),
+    TAP(0.0010223702739873592), TAP(-0.0005201940270101619), TAP(0.00019108766883558316), TAP(-2.5675926267922793e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.2411551024176912e-05), TAP(0.0001483239227886622), TAP(-0.0003265818140848144),
+    TAP(0.00046397380981436385), TAP(-0.0003139416854949183), TAP(-0.0005229682497439455), TAP(0.0025447977410603885),
+    TAP(-0.006219201625721186), TAP(0.011798734426745111), TAP(-0.019128659427275475), TAP(0.02751239878858962),
+    TAP(-0.035697448296295085), TAP(0.04205565362226311), TAP(-0.045466818328979336), TAP(0.05836284079914276),
+    TAP(0.7931321471817314), TAP(0.23396747292021405), TAP(-0.10195409125924808), TAP(0.06659783648066653),
+    TAP(-0.04450992507716685), TAP(0.02796510737164247), TAP(-0.015625020477942383), TAP(0.007090058577520749),
+    TAP(-0.0018750496170429655), TAP(-0.0007393154412547888), TAP(0.0015930178837097434), TAP(-0.001475174225691894),
+    TAP(0.0009917287847933808), TAP(-0.0005119134372001105), TAP(0.0001904926867347594), TAP(-2.6064483251450117e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.310701810283156e-05), TAP(0.00015292052982622697), TAP(-0.00034279226969418183),
+    TAP(0.0005048902889653614), TAP(-0.00039621117669454045), TAP(-0.0003852479769398731), TAP(0.0023510844009543576),
+    TAP(-0.005997504116826038), TAP(0.01162223302592457), TAP(-0.019131313207003606), TAP(0.02790351405995934),
+    TAP(-0.036784601836078464), TAP(0.04431805220211847), TAP(-0.04989095995985614), TAP(0.0694361759874105),
+    TAP(0.7962245952865842), TAP(0.22022786742095046), TAP(-0.09855545379722157), TAP(0.06547740815295021),
+    TAP(-0.04439504797892326), TAP(0.028310862397931322), TAP(-0.016127383926974742), TAP(0.007576498990589291),
+    TAP(-0.0022621406725017905), TAP(-0.00047415398644385157), TAP(0.0014358845073217138), TAP(-0.0013961693063084886),
+    TAP(0.0009597298772502023), TAP(-0.0005027863391473254), TAP(0.00018950536360550147), TAP(-2.634892362507888e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.375297091240775e-05), TAP(0.00015734209603154487), TAP(-0.0003587205942354577),
+    TAP(0.0005456842658974777), TAP(-0.0004792605605598553), TAP(-0.00024441097693485), TAP(0.002149696911708815),
+    TAP(-0.00576071849286846), TAP(0.011420229649776946), TAP(-0.019095786577241914), TAP(0.02824352211326229),
+    TAP(-0.03781135960875586), TAP(0.046522056395031146), TAP(-0.05429253835627163), TAP(0.0807736398041818),
+    TAP(0.7988473089805982), TAP(0.20662644975860697), TAP(-0.09502064799824744), TAP(0.06424195062478384),
+    TAP(-0.044193642162026626), TAP(0.028596656081464337), TAP(-0.016591960019396182), TAP(0.008041924256118533),
+    TAP(-0.002639580867587229), TAP(-0.00021193261657267347), TAP(0.001278449010390465), TAP(-0.0013158210951826714),
+    TAP(0.0009264690625609362), TAP(-0.0004928539959068369), TAP(0.00018814088886077177), TAP(-2.6533006573921625e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.434507590418725e-05), TAP(0.00016157143677847797), TAP(-0.0003743235402402024),
+    TAP(0.0005862656847024644), TAP(-0.0005629311164378052), TAP(-0.00010069500740501207), TAP(0.0019409304890004389),
+    TAP(-0.0055091173242798495), TAP(0.011192806740923683), TAP(-0.019021689665925524), TAP(0.02853113720316791),
+    TAP(-0.038774933595254045), TAP(0.048662475307034166), TAP(-0.058662457051130636), TAP(0.09236681036347587),
+    TAP(0.8009972812485665), TAP(0.19317557155054563), TAP(-0.09135924757859394), TAP(0.062895523681889),
+    TAP(-0.04390717013519899), TAP(0.028822629020472057), TAP(-0.01701827747069221), TAP(0.008485670832015731),
+    TAP(-0.0030067457401444764), TAP(4.6865287942240526e-05), TAP(0.0011210347643306332), TAP(-0.0012343186946702745),
+    TAP(0.000892042546416864), TAP(-0.00048215843275187215), TAP(0.00018641488999212363), TAP(-2.6620618624406434e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.4878973573738986e-05), TAP(0.0001655912788197026), TAP(-0.0003895574674756685),
+    TAP(0.0006265429798442413), TAP(-0.0006470598066461238), TAP(4.56522087675322e-05), TAP(0.0017250999611292226),
+    TAP(-0.0052430071283003764), TAP(0.010940099253992933), TAP(-0.018908705463185), TAP(0.028765162956151766),
+    TAP(-0.03967262648189967), TAP(0.05073416915118864), TAP(-0.06299150595709624), TAP(0.10420685397331061),
+    TAP(0.802672045988245), TAP(0.17988729058303995), TAP(-0.08758085637219466), TAP(0.061442340782543924),
+    TAP(-0.04353724221176209), TAP(0.028989038012393414), TAP(-0.017405946491902927), TAP(0.008907126682100017),
+    TAP(-0.0033630397705655814), TAP(0.00030177028549150655), TAP(0.0009639599016135153), TAP(-0.001151850179022928),
+    TAP(0.0008565470057475979), TAP(-0.00047074232321073423), TAP(0.00018434338086564643), TAP(-2.661575840960348e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.5350290629517837e-05), TAP(0.00016938430281957195), TAP(-0.0004043784359034449),
+    TAP(0.0006664232483177877), TAP(-0.000731479548772161), TAP(0.00019437334395452772), TAP(0.0015025394027525301),
+    TAP(-0.004962728195759247), TAP(0.010662295038385653), TAP(-0.018756591327785125), TAP(0.02894449579968023),
+    TAP(-0.040501838040205754), TAP(0.05273205965315432), TAP(-0.06727037463049566), TAP(0.11628453418654652),
+    TAP(0.8038696814954558), TAP(0.16677335645319072), TAP(-0.0836950931091519), TAP(0.05988675917852294),
+    TAP(-0.04308561162345109), TAP(0.029096254204963402), TAP(-0.017754658610706235), TAP(0.00930573187348311),
+    TAP(-0.0037078972082985537), TAP(0.0005523276348911871), TAP(0.0008075367386372791), TAP(-0.001068602215097964),
+    TAP(0.0008200793688689225), TAP(-0.00045864887622564866), TAP(0.0001819427104482526), TAP(-2.6522521590549314e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.575465259841157e-05), TAP(0.0001729331872320116), TAP(-0.0004187423016025285),
+    TAP(0.0007058124284054122), TAP(-0.0008160195017588731), TAP(0.0003452018525795233), TAP(0.0012736017228707408),
+    TAP(-0.004668654345601644), TAP(0.010359635117572244), TAP(-0.018565180361017636), TAP(0.029068128246142678),
+    TAP(-0.041260071392767717), TAP(0.05465114047397056), TAP(-0.07148966583758432), TAP(0.12859022149867294),
+    TAP(0.8045888131804305), TAP(0.15384519673387315), TAP(-0.07971157632200435), TAP(0.05823326990111947),
+    TAP(-0.04255416941790656), TAP(0.029144761043888714), TAP(-0.01806418633246592), TAP(0.009680979061576793),
+    TAP(-0.004040782826861831), TAP(0.0007980980158395517), TAP(0.0006520712198293172), TAP(-0.0009847596927279895),
+    TAP(0.0007827365994558058), TAP(-0.00044592172467494684), TAP(0.0001792295120847836), TAP(-2.634508597130437e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.6087696843980508e-05), TAP(0.00017622065344212326), TAP(-0.00043260481549161993),
+    TAP(0.0007446154847513816), TAP(-0.0009005053653872827), TAP(0.0004978623838340722), TAP(0.001038658207283958),
+    TAP(-0.004361192606728469), TAP(0.010032413863086233), TAP(-0.018334382643738108), TAP(0.02913515202338181),
+    TAP(-0.041944939151919866), TAP(0.05648648763141342), TAP(-0.07563990940329865), TAP(0.1411139036806529),
+    TAP(0.8048286155111243), TAP(0.14111390368065302), TAP(-0.07563990940329877), TAP(0.056486487631413396),
+    TAP(-0.04194493915191986), TAP(0.029135152023381815), TAP(-0.01833438264373809), TAP(0.010032413863086226),
+    TAP(-0.004361192606728468), TAP(0.0010386582072839585), TAP(0.0004978623838340721), TAP(-0.0009005053653872819),
+    TAP(0.0007446154847513833), TAP(-0.00043260481549161993), TAP(0.00017622065344212307), TAP(-2.6087696843980498e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.6345085971304375e-05), TAP(0.00017922951208478364), TAP(-0.0004459217246749466),
+    TAP(0.000782736599455804), TAP(-0.0009847596927279895), TAP(0.0006520712198293171), TAP(0.0007980980158395506),
+    TAP(-0.00404078282686183), TAP(0.009680979061576795), TAP(-0.018064186332465933), TAP(0.0291447610438887),
+    TAP(-0.042554169417906566), TAP(0.058233269901119454), TAP(-0.07971157632200425), TAP(0.15384519673387298),
+    TAP(0.8045888131804303), TAP(0.12859022149867302), TAP(-0.07148966583758434), TAP(0.05465114047397051),
+    TAP(-0.04126007139276768), TAP(0.029068128246142678), TAP(-0.01856518036101761), TAP(0.010359635117572227),
+    TAP(-0.004668654345601639), TAP(0.00127360172287074), TAP(0.00034520185257952304), TAP(-0.0008160195017588727),
+    TAP(0.0007058124284054132), TAP(-0.00041874230160252843), TAP(0.00017293318723201137), TAP(-2.575465259841155e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.6522521590549334e-05), TAP(0.00018194271044825279), TAP(-0.0004586488762256489),
+    TAP(0.0008200793688689214), TAP(-0.0010686022150979647), TAP(0.0008075367386372798), TAP(0.000552327634891187),
+    TAP(-0.003707897208298556), TAP(0.009305731873483124), TAP(-0.017754658610706266), TAP(0.029096254204963416),
+    TAP(-0.04308561162345114), TAP(0.05988675917852299), TAP(-0.08369509310915187), TAP(0.16677335645319072),
+    TAP(0.8038696814954561), TAP(0.11628453418654659), TAP(-0.06727037463049573), TAP(0.05273205965315434),
+    TAP(-0.040501838040205775), TAP(0.028944495799680253), TAP(-0.01875659132778511), TAP(0.010662295038385644),
+    TAP(-0.0049627281957592435), TAP(0.0015025394027525301), TAP(0.00019437334395452663), TAP(-0.0007314795487721613),
+    TAP(0.0006664232483177895), TAP(-0.0004043784359034451), TAP(0.00016938430281957182), TAP(-2.5350290629517844e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.6615758409603485e-05), TAP(0.00018434338086564648), TAP(-0.00047074232321073423),
+    TAP(0.0008565470057475963), TAP(-0.001151850179022929), TAP(0.0009639599016135164), TAP(0.0003017702854915064),
+    TAP(-0.0033630397705655796), TAP(0.008907126682100022), TAP(-0.017405946491902944), TAP(0.028989038012393425),
+    TAP(-0.04353724221176211), TAP(0.06144234078254395), TAP(-0.0875808563721946), TAP(0.17988729058303984),
+    TAP(0.8026720459882453), TAP(0.10420685397331064), TAP(-0.06299150595709624), TAP(0.05073416915118864),
+    TAP(-0.03967262648189967), TAP(0.02876516295615178), TAP(-0.01890870546318497), TAP(0.010940099253992919),
+    TAP(-0.00524300712830037), TAP(0.0017250999611292228), TAP(4.565220876753202e-05), TAP(-0.000647059806646124),
+    TAP(0.0006265429798442426), TAP(-0.0003895574674756685), TAP(0.00016559127881970233), TAP(-2.4878973573738976e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.6620618624406427e-05), TAP(0.00018641488999212363), TAP(-0.0004821584327518719),
+    TAP(0.0008920425464168625), TAP(-0.001234318694670275), TAP(0.0011210347643306352), TAP(4.686528794224069e-05),
+    TAP(-0.003006745740144474), TAP(0.008485670832015735), TAP(-0.01701827747069223), TAP(0.028822629020472057),
+    TAP(-0.04390717013519902), TAP(0.06289552368188901), TAP(-0.0913592475785938), TAP(0.19317557155054546),
+    TAP(0.8009972812485663), TAP(0.09236681036347587), TAP(-0.05866245705113065), TAP(0.04866247530703415),
+    TAP(-0.03877493359525403), TAP(0.02853113720316791), TAP(-0.019021689665925486), TAP(0.011192806740923666),
+    TAP(-0.005509117324279843), TAP(0.00194093048900044), TAP(-0.00010069500740501189), TAP(-0.000562931116437805),
+    TAP(0.000586265684702465), TAP(-0.0003743235402402022), TAP(0.0001615714367784777), TAP(-2.4345075904187248e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.6533006573921632e-05), TAP(0.0001881408888607717), TAP(-0.0004928539959068369),
+    TAP(0.0009264690625609348), TAP(-0.0013158210951826716), TAP(0.001278449010390467), TAP(-0.00021193261657267306),
+    TAP(-0.002639580867587225), TAP(0.008041924256118538), TAP(-0.016591960019396203), TAP(0.02859665608146435),
+    TAP(-0.044193642162026654), TAP(0.06424195062478388), TAP(-0.09502064799824732), TAP(0.20662644975860678),
+    TAP(0.7988473089805984), TAP(0.08077363980418183), TAP(-0.05429253835627167), TAP(0.046522056395031146),
+    TAP(-0.03781135960875587), TAP(0.028243522113262302), TAP(-0.01909578657724189), TAP(0.011420229649776932),
+    TAP(-0.005760718492868458), TAP(0.0021496969117088174), TAP(-0.0002444109769348503), TAP(-0.0004792605605598554),
+    TAP(0.0005456842658974785), TAP(-0.00035872059423545775), TAP(0.00015734209603154482), TAP(-2.3752970912407752e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.6348923625078884e-05), TAP(0.00018950536360550136), TAP(-0.0005027863391473252),
+    TAP(0.0009597298772502012), TAP(-0.0013961693063084882), TAP(0.0014358845073217147), TAP(-0.00047415398644384983),
+    TAP(-0.002262140672501787), TAP(0.007576498990589293), TAP(-0.016127383926974763), TAP(0.02831086239793132),
+    TAP(-0.04439504797892329), TAP(0.06547740815295022), TAP(-0.0985554537972214), TAP(0.22022786742095024),
+    TAP(0.7962245952865844), TAP(0.06943617598741049), TAP(-0.049890959959856145), TAP(0.04431805220211845),
+    TAP(-0.03678460183607847), TAP(0.02790351405995934), TAP(-0.019131313207003574), TAP(0.011622233025924555),
+    TAP(-0.005997504116826031), TAP(0.002351084400954359), TAP(-0.00038524797693987326), TAP(-0.0003962111766945402),
+    TAP(0.0005048902889653616), TAP(-0.0003427922696941818), TAP(0.00015292052982622686), TAP(-2.310701810283156e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.606448325145013e-05), TAP(0.00019049268673475942), TAP(-0.0005119134372001107),
+    TAP(0.0009917287847933797), TAP(-0.0014751742256918943), TAP(0.001593017883709745), TAP(-0.0007393154412547887),
+    TAP(-0.001875049617042962), TAP(0.0070900585775207515), TAP(-0.015625020477942404), TAP(0.027965107371642463),
+    TAP(-0.04450992507716688), TAP(0.06659783648066654), TAP(-0.10195409125924788), TAP(0.23396747292021386),
+    TAP(0.7931321471817316), TAP(0.05836284079914277), TAP(-0.04546681832897936), TAP(0.0420556536222631),
+    TAP(-0.03569744829629509), TAP(0.02751239878858962), TAP(-0.019128659427275454), TAP(0.0117987344267451),
+    TAP(-0.006219201625721181), TAP(0.0025447977410603916), TAP(-0.0005229682497439465), TAP(-0.0003139416854949181),
+    TAP(0.00046397380981436374), TAP(-0.00032658181408481426), TAP(0.00014832392278866214), TAP(-2.241155102417692e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.56759262679228e-05), TAP(0.00019108766883558305), TAP(-0.0005201940270101619),
+    TAP(0.001022370273987358), TAP(-0.001552646111153126), TAP(0.0017495211266459808), TAP(-0.0010069204635329114),
+    TAP(-0.0014789602087020277), TAP(0.0065833173550317045), TAP(-0.015085422469051903), TAP(0.027559368243140585),
+    TAP(-0.044536963410709486), TAP(0.06759933921981402), TAP(-0.10520703211106676), TAP(0.24783263566921898),
+    TAP(0.7895735083458515), TAP(0.04756163592625449), TAP(-0.04102908336816198), TAP(0.039740092286526175),
+    TAP(-0.034552771233628425), TAP(0.027071547850199957), TAP(-0.019088286337861114), TAP(0.01194970343741128),
+    TAP(-0.0064255724974759), TAP(0.0027305616493709956), TAP(-0.0006573443366417), TAP(-0.0002326062324269142),
+    TAP(0.0004230232094220668), TAP(-0.0003101319922718079), TAP(0.00014356932981182384), TAP(-2.1670865560197776e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.5179636182206904e-05), TAP(0.00019127561058345183), TAP(-0.000527587722576424),
+    TAP(0.001051559754321252), TAP(-0.0016283949772580273), TAP(0.001905062198526332), TAP(-0.001276460239504726),
+    TAP(-0.0010745520333466632), TAP(0.006057039634974419), TAP(-0.014509224061851142), TAP(0.02709374151637374),
+    TAP(-0.04447500981466162), TAP(0.0684781929319077), TAP(-0.10830480892735576), TAP(0.26181046145470827),
+    TAP(0.7855527541184303), TAP(0.03704013513085088), TAP(-0.03658658581712234), TAP(0.037376630246952494),
+    TAP(-0.03335352055021288), TAP(0.026582414907085183), TAP(-0.01901072450856239), TAP(0.012075161087437107),
+    TAP(-0.006616412288954272), TAP(0.0029081210507581035), TAP(-0.0007881593846741312), TAP(-0.00015235414406886892),
+    TAP(0.00038212503562670767), TAP(-0.0002934849999386144), TAP(0.00013867363643472463), TAP(-2.088920870030541e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.457215462265855e-05), TAP(0.0001910423549295582), TAP(-0.0005340551304034753),
+    TAP(0.0010792037846759743), TAP(-0.0017022309994456277), TAP(0.0020593056721712444), TAP(-0.001547414537627893),
+    TAP(-0.0006625307196207328), TAP(0.005512038768566185), TAP(-0.013897140469529714), TAP(0.026568444163173024),
+    TAP(-0.04432307217304284), TAP(0.06923085648824387), TAP(-0.11123803059068335), TAP(0.27588780824198195),
+    TAP(0.7810744857450226), TAP(0.026805477200622478), TAP(-0.03214800500647355), TAP(0.03497054973219961),
+    TAP(-0.03210271716537098), TAP(0.026046531918628765), TAP(-0.01889657210308389), TAP(0.012175179170367157),
+    TAP(-0.006791550596452445), TAP(0.0030772413063133923), TAP(-0.0009152074261833597), TAP(-7.332969914787802e-05),
+    TAP(0.0003413638522300082), TAP(-0.00027668238040607897), TAP(0.00013365352077749197), TAP(-2.0070767808701007e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.385019680063193e-05), TAP(0.00019037433933354032), TAP(-0.0005395579653052853),
+    TAP(0.001105210304046163), TAP(-0.0017739649249533499), TAP(0.0022119133831845976), TAP(-0.001819252623575584),
+    TAP(-0.00024362683597124277), TAP(0.0049491761005106966), TAP(-0.013249967476789741), TAP(0.025983814602733957),
+    TAP(-0.044080323325016574), TAP(0.0698539802194638), TAP(-0.11399739778166279), TAP(0.2900513024180539),
+    TAP(0.7761438238840203), TAP(0.01686435958268575), TAP(-0.027721856988429227), TAP(0.03252714299252277),
+    TAP(-0.030803446314904222), TAP(0.02546550521628224), TAP(-0.018746492889694183), TAP(0.012249879469159966),
+    TAP(-0.006950850947081441), TAP(0.0032377083963956938), TAP(-0.0010382936309769454), TAP(4.328085444998669e-06),
+    TAP(0.0003008220956079973), TAP(-0.00025976494496792845), TAP(0.00012852541709135312), TAP(-1.9219660408762622e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.3010666964386564e-05), TAP(0.00018925864790640565), TAP(-0.0005440591662907897),
+    TAP(0.0011294888637976965), TAP(-0.0018434084897514694), TAP(0.002362545098414801), TAP(-0.0020914342102527402),
+    TAP(0.0001814052782732265), TAP(0.004369359812410966), TAP(-0.012568580791798433), TAP(0.0253403134516512),
+    TAP(-0.04374610469920975), TAP(0.07034441483603594), TAP(-0.11657371847426291), TAP(0.3042873554501683),
+    TAP(0.7707664013840264), TAP(0.007223032707238898), TAP(-0.023316483058839935), TAP(0.030051702251401403),
+    TAP(-0.029458850803871447), TAP(0.024841011476635616), TAP(-0.01856121414392517), TAP(0.01229943288997997),
+    TAP(-0.007094210622164983), TAP(0.0033893290582983782), TAP(-0.0011572345309936569), TAP(8.048565345577324e-05),
+    TAP(0.00026057993900536965), TAP(-0.00024277269685391394), TAP(0.00012330548097688442), TAP(-1.833992449753235e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.2050673800483853e-05), TAP(0.00018768306332533918), TAP(-0.0005475230122550364),
+    TAP(0.0011519508609613102), TAP(-0.001910374840671817), TAP(0.0025108591993293038), TAP(-0.0023634104413297057),
+    TAP(0.0006117887461923572), TAP(0.0037735436565128778), TAP(-0.011853935229609166), TAP(0.024638524040461365),
+    TAP(-0.04331992966612664), TAP(0.07069922010139708), TAP(-0.1189579234110532), TAP(0.31858218093577995),
+    TAP(0.7649483553431943), TAP(-0.0021127049937730786), TAP(-0.018940038686096488), TAP(0.027549509780734976),
+    TAP(-0.02807212422627571), TAP(0.024174793601636144), TAP(-0.018341524448749136), TAP(0.012324058507266974),
+    TAP(-0.00722156041390122), TAP(0.0035319308788932953), TAP(-0.0012718582174233945), TAP(0.00015501509271693539),
+    TAP(0.00022071516466797358), TAP(-0.00022574475891999464), TAP(0.00011800955631819178), TAP(-1.7435509403255768e-05),
+  },
+  {
+    TAP(0.0), TAP(-2.0967545737611495e-05), TAP(0.00018563611837935532), TAP(-0.0005499152371942466),
+    TAP(0.0011725097720510348), TAP(-0.0019746789618904875), TAP(0.002656513379063402), TAP(-0.0026346249066866445),
+    TAP(0.0010467254491973665), TAP(0.0031627255810563045), TAP(-0.011107063726771295), TAP(0.023879152693066157),
+    TAP(-0.04280148659909648), TAP(0.07091567323976644), TAP(-0.12114108153302461), TAP(0.3329218120193943),
+    TAP(0.7586963184630364), TAP(-0.011137511368932585), TAP(-0.014600482861631753), TAP(0.02502582811614982),
+    TAP(-0.02664650416500347), TAP(0.023468656515097726), TAP(-0.01808827139781825), TAP(0.01232402252309961),
+    TAP(-0.007332864316659641), TAP(0.003665362342697763), TAP(-0.0013820045102939874), TAP(0.00022779430311413708),
+    TAP(0.00018130304394708098), TAP(-0.00020871930515378273), TAP(0.00011265314397499952), TAP(-1.6510267197040175e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.975884610687971e-05), TAP(0.0001831071470023168), TAP(-0.0005512031446582891),
+    TAP(0.001191081386885338), TAP(-0.0020361381049005117), TAP(0.0027991653518558584), TAP(-0.0029045146880722138),
+    TAP(0.0014853973837000599), TAP(0.0025379462487486524), TAP(-0.01032907618718689), TAP(0.023063028765835936),
+    TAP(-0.04219064163464643), TAP(0.07099127706095257), TAP(-0.12311441533853268), TAP(0.3472921191509989),
+    TAP(0.7520174097102857), TAP(-0.019846504127653947), TAP(-0.01030556788592363), TAP(0.02248589042854609),
+    TAP(-0.025185265385257186), TAP(0.022724462884709556), TAP(-0.01780235920748305), TAP(0.012299637144008186),
+    TAP(-0.007428119154402575), TAP(0.0037894928358989492), TAP(-0.001487525100596626), TAP(0.00029870714897551926),
+    TAP(0.00014241622548825358), TAP(-0.00019173349607229053), TAP(0.00010725137226895582), TAP(-1.556794466782562e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.842238811184646e-05), TAP(0.00018008633464773995), TAP(-0.0005513557211498419),
+    TAP(0.0012075840418790894), TAP(-0.0020945722210882864), TAP(0.002938473573537608), TAP(-0.0031725114331925077),
+    TAP(0.0019269680764892223), TAP(0.0019002874501132902), TAP(-0.009521158159614055), TAP(0.02219110444363397),
+    TAP(-0.04148744112366701), TAP(0.07092376778481672), TAP(-0.12486931614586003), TAP(0.3616788281601935),
+    TAP(0.7449192243014979), TAP(-0.028235263716755263), TAP(-0.006062829603058508), TAP(0.01993489106757507),
+    TAP(-0.023691713034597408), TAP(0.021944128778800732), TAP(-0.01748474624342614), TAP(0.012251259378523687),
+    TAP(-0.007507354145834133), TAP(0.0039042126069554393), TAP(-0.001588283665079758), TAP(0.0003676435958251274),
+    TAP(0.00010412463159687979), TAP(-0.00017482341807790945), TAP(0.00010181896929482707), TAP(-1.4612175868009104e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.6956249560852423e-05), TAP(0.00017656476785802365), TAP(-0.0005503437481758966),
+    TAP(0.001221938852265673), TAP(-0.0021498043960068974), TAP(0.0030740979716957764), TAP(-0.0034380424563613993),
+    TAP(0.0023705840566275887), TAP(0.001250870413702002), TAP(-0.00868456934756065), TAP(0.021264454290450277),
+    TAP(-0.040692113765231186), TAP(0.07071112254843039), TAP(-0.1263973592338862), TAP(0.3760675386195378),
+    TAP(0.7374098230261233), TAP(-0.03629983549267635), TAP(-0.001879578096051945), TAP(0.017377976292274094),
+    TAP(-0.02216917586255887), TAP(0.021129619267145756), TAP(-0.017136442467853313), TAP(0.012179289758872355),
+    TAP(-0.007570630408988078), TAP(0.004009432684478798), TAP(-0.0016841559538981051), TAP(0.00043449983147743175),
+    TAP(6.64953628519152e-05), TAP(-0.00015802402682749085), TAP(9.637023708166512e-05), TAP(-1.3646475235231402e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.5358787313685713e-05), TAP(0.0001725344828793159), TAP(-0.0005481399126543026),
+    TAP(0.001234069942700985), TAP(-0.0022016612844206664), TAP(0.003205700684093612), TAP(-0.0037005318637615076),
+    TAP(0.002815376381537024), TAP(0.0005908540153959655), TAP(-0.007820641952659132), TAP(0.020284274552792837),
+    TAP(-0.03980507241544441), TAP(0.07035156657937532), TAP(-0.12769031883539145), TAP(0.3904437424701023),
+    TAP(0.7294977209248156), TAP(-0.04403673118986177), TAP(0.0022371111457544788), TAP(0.014820235203599619),
+    TAP(-0.020620999472633402), TAP(0.020282943975106767), TAP(-0.016758506813277323), TAP(0.01208417099033987),
+    TAP(-0.007618040407069956), TAP(0.004105084753178258), TAP(-0.0017750298513591121), TAP(0.0004991783714850432),
+    TAP(2.9592611019009004e-05), TAP(-0.00014136909465844693), TAP(9.091902762350266e-05), TAP(-1.2674231294033355e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.3628651394155769e-05), TAP(0.00016798851317215054), TAP(-0.0005447189153757406),
+    TAP(0.0012439046756944916), TAP(-0.002249973545178061), TAP(0.0033329468038877435), TAP(-0.003959401701286033),
+    TAP(0.003260462214797114), TAP(-7.856711074692985e-05), TAP(-0.006930778852960852), TAP(0.019251882214450525),
+    TAP(-0.03882691556423712), TAP(0.06984358001907635), TAP(-0.1287401829575983), TAP(0.4047928428816995),
+    TAP(0.7211918753407413), TAP(-0.05144292968696089), TAP(0.006280405576791327), TAP(0.012266690893089167),
+    TAP(-0.01905053961921535), TAP(0.0194061526003997), TAP(-0.0163520444890095), TAP(0.011966386531934861),
+    TAP(-0.007649707337467376), TAP(0.004191120988729261), TAP(-0.0018608054100633508), TAP(0.000561588148986145),
+    TAP(-6.522419705873676e-06), TAP(-0.00012489116210494456), TAP(8.547872079368068e-05), TAP(-1.1698700939317465e-05),
+  },
+  {
+    TAP(0.0), TAP(-1.176479871983769e-05), TAP(0.00016292093566728193), TAP(-0.0005400575772198914),
+    TAP(0.001251373877307209), TAP(-0.002294576274954848), TAP(0.003455505130147593), TAP(-0.004214073122856109),
+    TAP(0.00370494645304324), TAP(-0.0007561645574094592), TAP(-0.006016451617937465), TAP(0.01816871380171651),
+    TAP(-0.037758428473564226), TAP(0.06918590438053093), TAP(-0.12953916800467985), TAP(0.4191001733198235),
+    TAP(0.7125016733626311), TAP(-0.058515877073624295), TAP(0.010243723453329533), TAP(0.00972229182135193),
+    TAP(-0.017461155561887407), TAP(0.01850133040174509), TAP(-0.015918204226540732), TAP(0.011826459112078544),
+    TAP(-0.007665784465935729), TAP(0.004267513852501221), TAP(-0.0019413948587881688), TAP(0.0006216445890319174),
+    TAP(-4.179158311100077e-05), TAP(-0.00010862149352657771), TAP(8.006220415154335e-05), TAP(-1.0723004301816616e-05),
+  },
+  {
+    TAP(0.0), TAP(-9.766506400058283e-06), TAP(0.00015732691561581196), TAP(-0.0005341349428236559),
+    TAP(0.0012564120595523161), TAP(-0.0023353094398959958), TAP(0.0035730489221479766), TAP(-0.0044639675770362045),
+    TAP(0.0041479233992150555), TAP(-0.0014406782217801235), TAP(-0.005079198362325974), TAP(0.01703632393864183),
+    TAP(-0.03660058397104752), TAP(0.068377548625308), TAP(-0.1300797331771315), TAP(0.4333510167909148),
+    TAP(0.7034369186792421), TAP(-0.06525348602179232), TAP(0.014120741190906363), TAP(0.007191903439536656),
+    TAP(-0.015856203489185233), TAP(0.017570593668620026), TAP(-0.015458175470046949), TAP(0.011664949183135787),
+    TAP(-0.00766645440805465), TAP(0.004334255847151577), TAP(-0.002016722584515127), TAP(0.0006792696675072487),
+    TAP(-7.615985304969687e-05), TAP(-9.259003686137294e-05), TAP(7.46818546449721e-05), TAP(-9.750120194078143e-06),
+  },
+  {
+    TAP(0.0), TAP(-7.6333845531348e-06), TAP(0.00015120274988275972), TAP(-0.0005269323813990713),
+    TAP(0.0012589576389312209), TAP(-0.0023720183041733836), TAP(0.003685256655874933), TAP(-0.004708508009701662),
+    TAP(0.004588478479275039), TAP(-0.0021308184730240575), TAP(-0.004120621441302789), TAP(0.01585638365237586),
+    TAP(-0.03535454289368344), TAP(0.06741779484522507), TAP(-0.13035459462311313), TAP(0.44753062523720827),
+    TAP(0.6940078178658264), TAP(-0.07165413446647881), TAP(0.017905400213419142), TAP(0.0046803000663546875),
+    TAP(-0.014239030023718627), TAP(0.016616085181265314), TAP(-0.014973185518294376), TAP(0.011482453318682221),
+    TAP(-0.007651928360133089), TAP(0.004391359234161709), TAP(-0.002086725089051312), TAP(0.000734391954790229),
+    TAP(-0.00010957537721459359), TAP(-7.68253875046534e-05), TAP(6.934952220707476e-05), TAP(-8.782882133822403e-06),
+  },
+  {
+    TAP(0.0), TAP(-5.36538859395103e-06), TAP(0.00014454590853366545), TAP(-0.0005184336843990895),
+    TAP(0.001258953150536214), TAP(-0.00240455385446698), TAP(0.0037918127811567446), TAP(-0.004947120080447895),
+    TAP(0.005025689999390104), TAP(-0.0028252684060972393), TAP(-0.003142384989819025), TAP(0.014630678429141482),
+    TAP(-0.03402165417684218), TAP(0.06630620353468084), TAP(-0.13035673931712483), TAP(0.4616242390520952),
+    TAP(0.6842249661240597), TAP(-0.07771666360214459), TAP(0.021591913287125546), TAP(0.002192157032647761),
+    TAP(-0.012612965820246154), TAP(0.015639969670022316), TAP(-0.014464496624246776), TAP(0.011279602557472467),
+    TAP(-0.007622445281817668), TAP(0.004438855714455557), TAP(-0.002151350920742426), TAP(0.0007869466443272555),
+    TAP(-0.00014198952265108747), TAP(-6.13547563051554e-05), TAP(6.407651524031397e-05), TAP(-7.823974939933985e-06),
+  },
+  {
+    TAP(0.0), TAP(-2.9628309431647216e-06), TAP(0.00013735507456466908), TAP(-0.0005086251597306564),
+    TAP(0.0012563454571505347), TAP(-0.002432773219369783), TAP(0.003892408477807166), TAP(-0.005179233390370264),
+    TAP(0.005458630940447268), TAP(-0.0035226861783249123), TAP(-0.002146212309274954), TAP(0.013361106021888947),
+    TAP(-0.03260345458440171), TAP(0.06504261844021808), TAP(-0.13007943864167557), TAP(0.47561710668667195),
+    TAP(0.6740993324977164), TAP(-0.08344037520183473), TAP(0.025174770333723465), TAP(-0.00026795689511506683),
+    TAP(-0.01098131926800024), TAP(0.014644429282976998), TAP(-0.013933403058691021), TAP(0.01105706069813614),
+    TAP(-0.007578271032730256), TAP(0.0044767960733037), TAP(-0.002210560581821608), TAP(0.0008368755663309893),
+    TAP(-0.00017335691307396266), TAP(-4.620394165991209e-05), TAP(5.8873587976461705e-05), TAP(-6.8759318947944106e-06),
+  },
+  {
+    TAP(0.0), TAP(-4.263921096889497e-07), TAP(0.00012963018162775604), TAP(-0.0004974957222165517),
+    TAP(0.0012510859527775865), TAP(-0.002456540082711629), TAP(0.003986742409146021), TAP(-0.005404282718787521),
+    TAP(0.005886370786657488), TAP(-0.004221707424953623), TAP(-0.0011338831050541186), TAP(0.01204967401117073),
+    TAP(-0.031101668076492006), TAP(0.06362717097451934), TAP(-0.12951626164794827), TAP(0.48949450431791913),
+    TAP(0.6636422445871942), TAP(-0.08882502826731511), TAP(0.02864874371762123), TAP(-0.0026955868016476916),
+    TAP(-0.009347370308241003), TAP(0.013631659070775425), TAP(-0.01338122814419848), TAP(0.01081552254868074),
+    TAP(-0.007519697465526181), TAP(0.004505249790774286), TAP(-0.0022643264119820653), TAP(0.0008841271868378456),
+    TAP(-0.00020363545806881592), TAP(-3.139730567977504e-05), TAP(5.3750929696011906e-05), TAP(-5.941132465170857e-06),
+  },
+  {
+    TAP(0.0), TAP(2.2428689014212573e-06), TAP(0.0001213724496045234), TAP(-0.00048503698001022124),
+    TAP(0.0012431307600333258), TAP(-0.00247572508979386), TAP(0.004074521471243743), TAP(-0.005621709266429802),
+    TAP(0.006307977384890229), TAP(-0.004920947749680227), TAP(-0.0001072305787764873), TAP(0.010698497121280329),
+    TAP(-0.02951820481196795), TAP(0.062060284182689524), TAP(-0.1286610879718456), TAP(0.5032417555487809),
+    TAP(0.6528653727867342), TAP(-0.09387083501948576), TAP(0.03200889300344861), TAP(-0.005086398609835687),
+    TAP(-0.007714364377679885), TAP(0.012603862497344638), TAP(-0.01280932126572773), TAP(0.010555712134924011),
+    TAP(-0.007447041477823974), TAP(0.004524304619047043), TAP(-0.002312632448803743), TAP(0.0009286565923900788),
+    TAP(-0.0002327863742770795), TAP(-1.6957754388083476e-05), TAP(4.87181557860835e-05), TAP(-5.0218005724388095e-06),
+  },
+  {
+    TAP(0.0), TAP(5.043504902913605e-06), TAP(0.00011258441788390385), TAP(-0.00047124331667140057),
+    TAP(0.0012324409208394858), TAP(-0.0024902062455260244), TAP(0.004155461536221164), TAP(-0.0058309619025650765),
+    TAP(0.006722518831275397), TAP(-0.005619005285960823), TAP(0.0009318616205343401), TAP(0.009309794294199885),
+    TAP(-0.027855159783385857), TAP(0.06034267624936308), TAP(-0.12750812038222922), TAP(0.5168442511102954),
+    TAP(0.641780714068909), TAP(-0.09857845623937334), TAP(0.03525056918079925), TAP(-0.007436185758421848),
+    TAP(-0.006085506488061103), TAP(0.011563246985107401), TAP(-0.012219054864150208), TAP(0.010278380872012726),
+    TAP(-0.007360644025511363), TAP(0.004534066127958224), TAP(-0.0023554742657044534), TAP(0.0009704254606348852),
+    TAP(-0.0002607741986800402), TAP(-2.9067219059162726e-06), TAP(4.3784300611407416e-05), TAP(-4.120003401540942e-06),
+  },
+  {
+    TAP(0.0), TAP(7.973671607576223e-06), TAP(0.00010326997620177677), TAP(-0.0004561119686146474),
+    TAP(0.001218982579860271), TAP(-0.0024998693034571093), TAP(0.004229288187924039), TAP(-0.006031498413495445),
+    TAP(0.007129065381509528), TAP(-0.006314463324708757), TAP(0.0019814625818451678), TAP(0.007885885524403299),
+    TAP(-0.02611481108292336), TAP(0.05847536353587813), TAP(-0.1260518969386311), TAP(0.5302874685358416),
+    TAP(0.6304005753416349), TAP(-0.10294899597100504), TAP(0.03836941835413259), TAP(-0.00974087556156768),
+    TAP(-0.004463955451818265), TAP(0.01051201950311768), TAP(-0.011611821418943168), TAP(0.009984305703210523),
+    TAP(-0.007260869099979868), TAP(0.004534657220191998), TAP(-0.002392858788123933), TAP(0.0010094020171591111),
+    TAP(-0.00028756679411327666), TAP(1.0735841431405163e-05), TAP(3.8957812168724465e-05), TAP(-3.237650736772011e-06),
+  },
+  {
+    TAP(0.0), TAP(1.103111952430898e-05), TAP(9.343439290332236e-05), TAP(-0.00043964309764802024),
+    TAP(0.0012027271601315365), TAP(-0.002504608144697524), TAP(0.004295737448283403), TAP(-0.006222786749817291),
+    TAP(0.00752669138120932), TAP(-0.007005893003803761), TAP(0.003039597449218824), TAP(0.006429188458062786),
+    TAP(-0.024299617798358188), TAP(0.056459663137492455), TAP(-0.12428730273622696), TAP(0.5435569917775535),
+    TAP(0.6187375564035922), TAP(-0.10698399559844467), TAP(0.04136138489670045), TAP(-0.011996535242137885),
+    TAP(-0.002852818263338552), TAP(0.009452382206367594), TAP(-0.010989030426245727), TAP(0.009674287210153844),
+    TAP(-0.007148102671882321), TAP(0.0045262176175780615), TAP(-0.0024248040886852697), TAP(0.0010455609789032454),
+    TAP(-0.0003131353471583385), TAP(2.395147709034192e-05), TAP(3.424654849083305e-05), TAP(-2.3764948112328777e-06),
+  },
+  {
+    TAP(0.0), TAP(1.4213186712503212e-05), TAP(8.308434049231129e-05), TAP(-0.00042183985832502095),
+    TAP(0.0011836515303391827), TAP(-0.0025043251457338898), TAP(0.004354556492668038), TAP(-0.006404306269806719),
+    TAP(0.007914477212568468), TAP(-0.007691856054654407), TAP(0.004104250865463404), TAP(0.004942214760705735),
+    TAP(-0.022412217538903247), TAP(0.054297194951369636), TAP(-0.12220958121640688), TAP(0.5566385307349584),
+    TAP(0.6068045325245343), TAP(-0.11068542731022395), TAP(0.0442227140682918), TAP(-0.014199377631234727),
+    TAP(-0.0012551446449665965), TAP(0.008386528134325453), TAP(-0.0103521053784124), TAP(0.009349147698782721),
+    TAP(-0.007022751604043255), TAP(0.004508903319995439), TAP(-0.002451339162111884), TAP(0.0010788834845221692),
+    TAP(-0.0003374543585732707), TAP(3.6723222559575337e-05), TAP(2.9657775762621768e-05), TAP(-1.538130655617723e-06),
+  },
+  {
+    TAP(0.0), TAP(1.751679243799208e-05), TAP(7.222791833529224e-05), TAP(-0.0004027084598396146),
+    TAP(0.0011617381632126715), TAP(-0.00249893153414707), TAP(0.0044055043525342095), TAP(-0.006575548976264598),
+    TAP(0.00829151125349355), TAP(-0.008370907600884181), TAP(0.005173370536845914), TAP(0.0034275662578653505),
+    TAP(-0.020455423591386124), TAP(0.051989883246842374), TAP(-0.11981434502187073), TAP(0.5695179406659883),
+    TAP(0.5946146366775222), TAP(-0.11405568696532924), TAP(0.04694995409751563), TAP(-0.016345766527195108),
+    TAP(0.0003260782335328865), TAP(0.007316636976559957), TAP(-0.009702480751126003), TAP(0.009009729265152325),
+    TAP(-0.006885242536182184), TAP(0.0044828860384192966), TAP(-0.0024725036807098184), TAP(0.0011093570120827966),
+    TAP(-0.0003605016264376929), TAP(4.903561185450177e-05), TAP(2.519816810771371e-05), TAP(-7.239969308893839e-07),
+  },
+  {
+    TAP(0.0), TAP(2.0938431772476102e-05), TAP(6.087467239282313e-05), TAP(-0.0003822582222015794),
+    TAP(0.0011369752845100472), TAP(-0.0024883477312543645), TAP(0.004448352603680179), TAP(-0.006736020744133467),
+    TAP(0.008656891845321122), TAP(-0.009041599004047392), TAP(0.0062448709130871905), TAP(0.0018879308537611654),
+    TAP(-0.01843222170795525), TAP(0.04953995773025619), TAP(-0.11709758637580064), TAP(0.5821812414506113),
+    TAP(0.5821812414506119), TAP(-0.11709758637580078), TAP(0.04953995773025614), TAP(-0.018432221707955262),
+    TAP(0.0018879308537611682), TAP(0.006244870913087185), TAP(-0.009041599004047373), TAP(0.008656891845321113),
+    TAP(-0.00673602074413347), TAP(0.004448352603680177), TAP(-0.0024883477312543645), TAP(0.0011369752845100476),
+    TAP(-0.00038225822220157936), TAP(6.087467239282317e-05), TAP(2.0938431772476125e-05), TAP(0.0),
+  },
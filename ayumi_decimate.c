@@ -0,0 +1,569 @@
+/* Stereo, mono and stem FIR decimators with runtime CPU dispatch */
+
+#include "ayumi_internal.h"
+
+/* Fixed point has only the scalar kernel */
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(AYUMI_SAMPLE_FIXED)
+#define AYUMI_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && !defined(AYUMI_SAMPLE_FIXED)
+#define AYUMI_NEON 1
+#include <arm_neon.h>
+#endif
+
+/*
+ * Symmetric low-pass taps 0..n / 2 of each tier, tap k is also tap n - k.
+ * Every coefficient is stored twice, once per stereo lane, so a vector of
+ * interleaved left/right history is multiplied without a shuffle.
+ */
+#define TAP(x) {x, x}
+const double ayumi_fir_taps[FIR_SIZE / 2 + 1][2] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps.h"
+};
+const double ayumi_fir_taps_draft[FIR_SIZE_DRAFT / 2 + 1][2] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps_draft.h"
+};
+const double ayumi_fir_taps_high[FIR_SIZE_HIGH / 2 + 1][2] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps_high.h"
+};
+#undef TAP
+
+#ifndef AYUMI_SAMPLE_DOUBLE
+#define TAP(x) {SAMPLE(x), SAMPLE(x)}
+const ayumi_sample ayumi_fir_sample_taps[FIR_SIZE / 2 + 1][2] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps.h"
+};
+const ayumi_sample ayumi_fir_sample_taps_draft[FIR_SIZE_DRAFT / 2 + 1][2] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps_draft.h"
+};
+const ayumi_sample ayumi_fir_sample_taps_high[FIR_SIZE_HIGH / 2 + 1][2] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps_high.h"
+};
+#undef TAP
+#endif
+
+/* The same taps once each, for the mono kernels */
+#define TAP(x) SAMPLE(x)
+static const ayumi_sample Mono_taps[FIR_SIZE / 2 + 1] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps.h"
+};
+static const ayumi_sample Mono_taps_draft[FIR_SIZE_DRAFT / 2 + 1] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps_draft.h"
+};
+static const ayumi_sample Mono_taps_high[FIR_SIZE_HIGH / 2 + 1] __attribute__((aligned(64))) = {
+#include "ayumi_fir_taps_high.h"
+};
+#undef TAP
+
+/*
+ * Every kernel below is written once for n taps and inlined into one
+ * function per quality tier, so n is a constant in each of them.
+ */
+#define TIERS(kernel, attributes) \
+  attributes static void kernel##_draft(const ayumi_sample (*x)[2], ayumi_sample* y) { \
+    kernel(x, y, ayumi_fir_sample_taps_draft, FIR_SIZE_DRAFT); \
+  } \
+  attributes static void kernel##_standard(const ayumi_sample (*x)[2], ayumi_sample* y) { \
+    kernel(x, y, ayumi_fir_sample_taps, FIR_SIZE); \
+  } \
+  attributes static void kernel##_high(const ayumi_sample (*x)[2], ayumi_sample* y) { \
+    kernel(x, y, ayumi_fir_sample_taps_high, FIR_SIZE_HIGH); \
+  } \
+  static const ayumi_decimator kernel##_tiers[] = {kernel##_draft, kernel##_standard, kernel##_high}
+
+#define INLINE __attribute__((always_inline)) static inline
+
+/*
+ * x points to n interleaved left/right frames, newest first.
+ * The scalar kernel sums the taps in the order of the original unrolled
+ * expression and is the reference for the vector kernels below.
+ */
+INLINE void decimate_scalar(const ayumi_sample (*x)[2], ayumi_sample* y,
+  const ayumi_sample (*taps)[2], const int n) {
+  int i;
+  ayumi_accum left = 0;
+  ayumi_accum right = 0;
+  for (i = 1; i < n / 2; i += 1) {
+    left += ACCUM_MUL(taps[i][0], x[i][0] + x[n - i][0]);
+    right += ACCUM_MUL(taps[i][1], x[i][1] + x[n - i][1]);
+  }
+  y[0] = ACCUM_TO_SAMPLE(left + ACCUM_MUL(taps[n / 2][0], x[n / 2][0]));
+  y[1] = ACCUM_TO_SAMPLE(right + ACCUM_MUL(taps[n / 2][1], x[n / 2][1]));
+}
+
+TIERS(decimate_scalar, );
+
+#if defined(AYUMI_X86) && defined(AYUMI_SAMPLE_DOUBLE)
+
+INLINE __attribute__((target("sse2")))
+void decimate_sse2(const double (*x)[2], double* y, const double (*taps)[2], const int n) {
+  int i;
+  __m128d acc0 = _mm_setzero_pd();
+  __m128d acc1 = _mm_setzero_pd();
+  for (i = 1; i < n / 2 - 1; i += 2) {
+    acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_load_pd(taps[i]),
+      _mm_add_pd(_mm_loadu_pd(x[i]), _mm_loadu_pd(x[n - i]))));
+    acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_load_pd(taps[i + 1]),
+      _mm_add_pd(_mm_loadu_pd(x[i + 1]), _mm_loadu_pd(x[n - i - 1]))));
+  }
+  acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_load_pd(taps[i]),
+    _mm_add_pd(_mm_loadu_pd(x[i]), _mm_loadu_pd(x[n - i]))));
+  acc0 = _mm_add_pd(acc0, acc1);
+  acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_load_pd(taps[n / 2]),
+    _mm_loadu_pd(x[n / 2])));
+  _mm_storeu_pd(y, acc0);
+}
+
+/* Two taps per vector, the mirrored pair is swapped back into tap order */
+INLINE __attribute__((target("avx2,fma")))
+void decimate_avx2(const double (*x)[2], double* y, const double (*taps)[2], const int n) {
+  int i;
+  __m256d a;
+  __m256d b;
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  __m128d acc;
+  for (i = 1; i + 3 < n / 2 - 1; i += 4) {
+    a = _mm256_loadu_pd(x[i]);
+    b = _mm256_loadu_pd(x[n - i - 1]);
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(taps[i]),
+      _mm256_add_pd(a, _mm256_permute2f128_pd(b, b, 1)), acc0);
+    a = _mm256_loadu_pd(x[i + 2]);
+    b = _mm256_loadu_pd(x[n - i - 3]);
+    acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(taps[i + 2]),
+      _mm256_add_pd(a, _mm256_permute2f128_pd(b, b, 1)), acc1);
+  }
+  for (; i < n / 2 - 1; i += 2) {
+    a = _mm256_loadu_pd(x[i]);
+    b = _mm256_loadu_pd(x[n - i - 1]);
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(taps[i]),
+      _mm256_add_pd(a, _mm256_permute2f128_pd(b, b, 1)), acc0);
+  }
+  acc0 = _mm256_add_pd(acc0, acc1);
+  acc = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+  for (; i < n / 2; i += 1) {
+    acc = _mm_fmadd_pd(_mm_load_pd(taps[i]),
+      _mm_add_pd(_mm_loadu_pd(x[i]), _mm_loadu_pd(x[n - i])), acc);
+  }
+  acc = _mm_fmadd_pd(_mm_load_pd(taps[n / 2]), _mm_loadu_pd(x[n / 2]), acc);
+  _mm_storeu_pd(y, acc);
+}
+
+/* Four taps per vector, the mirrored quad is reversed by 128-bit lanes */
+INLINE __attribute__((target("avx512f,avx2,fma")))
+void decimate_avx512(const double (*x)[2], double* y, const double (*taps)[2], const int n) {
+  int i;
+  __m512d b;
+  __m512d acc0 = _mm512_setzero_pd();
+  __m256d acc1;
+  __m256d b1;
+  __m128d acc;
+  for (i = 1; i + 3 < n / 2 - 1; i += 4) {
+    b = _mm512_loadu_pd(x[n - i - 3]);
+    acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(taps[i]),
+      _mm512_add_pd(_mm512_loadu_pd(x[i]), _mm512_shuffle_f64x2(b, b, _MM_SHUFFLE(0, 1, 2, 3))),
+      acc0);
+  }
+  acc1 = _mm256_add_pd(_mm512_castpd512_pd256(acc0), _mm512_extractf64x4_pd(acc0, 1));
+  for (; i < n / 2 - 1; i += 2) {
+    b1 = _mm256_loadu_pd(x[n - i - 1]);
+    acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(taps[i]),
+      _mm256_add_pd(_mm256_loadu_pd(x[i]), _mm256_permute2f128_pd(b1, b1, 1)), acc1);
+  }
+  acc = _mm_add_pd(_mm256_castpd256_pd128(acc1), _mm256_extractf128_pd(acc1, 1));
+  for (; i < n / 2; i += 1) {
+    acc = _mm_fmadd_pd(_mm_load_pd(taps[i]),
+      _mm_add_pd(_mm_loadu_pd(x[i]), _mm_loadu_pd(x[n - i])), acc);
+  }
+  acc = _mm_fmadd_pd(_mm_load_pd(taps[n / 2]), _mm_loadu_pd(x[n / 2]), acc);
+  _mm_storeu_pd(y, acc);
+}
+
+TIERS(decimate_sse2, __attribute__((target("sse2"))));
+TIERS(decimate_avx2, __attribute__((target("avx2,fma"))));
+TIERS(decimate_avx512, __attribute__((target("avx512f,avx2,fma"))));
+
+#endif
+
+#if defined(AYUMI_X86) && defined(AYUMI_SAMPLE_FLOAT)
+
+/* Loads the taps of x[i] and x[n - i] into the low two floats */
+#define PAIR(x, i) _mm_add_ps(_mm_castpd_ps(_mm_load_sd((const double*) (x)[i])), \
+  _mm_castpd_ps(_mm_load_sd((const double*) (x)[n - (i)])))
+#define TAPS(i) _mm_castpd_ps(_mm_load_sd((const double*) taps[i]))
+
+/* Two taps per vector, the mirrored pair is swapped back into tap order */
+INLINE __attribute__((target("sse2")))
+void decimate_sse2(const float (*x)[2], float* y, const float (*taps)[2], const int n) {
+  int i;
+  __m128 b;
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  for (i = 1; i + 3 < n / 2 - 1; i += 4) {
+    b = _mm_loadu_ps(x[n - i - 1]);
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(taps[i]),
+      _mm_add_ps(_mm_loadu_ps(x[i]), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)))));
+    b = _mm_loadu_ps(x[n - i - 3]);
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(taps[i + 2]),
+      _mm_add_ps(_mm_loadu_ps(x[i + 2]), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)))));
+  }
+  for (; i < n / 2 - 1; i += 2) {
+    b = _mm_loadu_ps(x[n - i - 1]);
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(taps[i]),
+      _mm_add_ps(_mm_loadu_ps(x[i]), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)))));
+  }
+  acc0 = _mm_add_ps(acc0, acc1);
+  acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+  acc0 = _mm_add_ps(acc0, _mm_mul_ps(TAPS(i), PAIR(x, i)));
+  acc0 = _mm_add_ps(acc0, _mm_mul_ps(TAPS(n / 2),
+    _mm_castpd_ps(_mm_load_sd((const double*) x[n / 2]))));
+  _mm_store_sd((double*) y, _mm_castps_pd(acc0));
+}
+
+/* Four taps per vector, the mirrored quad is reversed by pairs */
+INLINE __attribute__((target("avx2,fma")))
+void decimate_avx2(const float (*x)[2], float* y, const float (*taps)[2], const int n) {
+  int i;
+  __m256 b;
+  __m256 acc0 = _mm256_setzero_ps();
+  const __m256i reverse = _mm256_setr_epi32(6, 7, 4, 5, 2, 3, 0, 1);
+  __m128 acc;
+  __m128 b1;
+  for (i = 1; i + 3 < n / 2 - 1; i += 4) {
+    b = _mm256_loadu_ps(x[n - i - 3]);
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(taps[i]),
+      _mm256_add_ps(_mm256_loadu_ps(x[i]), _mm256_permutevar8x32_ps(b, reverse)), acc0);
+  }
+  acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+  for (; i < n / 2 - 1; i += 2) {
+    b1 = _mm_loadu_ps(x[n - i - 1]);
+    acc = _mm_fmadd_ps(_mm_loadu_ps(taps[i]),
+      _mm_add_ps(_mm_loadu_ps(x[i]), _mm_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 0, 3, 2))), acc);
+  }
+  acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+  acc = _mm_fmadd_ps(TAPS(i), PAIR(x, i), acc);
+  acc = _mm_fmadd_ps(TAPS(n / 2), _mm_castpd_ps(_mm_load_sd((const double*) x[n / 2])), acc);
+  _mm_store_sd((double*) y, _mm_castps_pd(acc));
+}
+
+#undef PAIR
+#undef TAPS
+
+TIERS(decimate_sse2, __attribute__((target("sse2"))));
+TIERS(decimate_avx2, __attribute__((target("avx2,fma"))));
+
+#endif
+
+#if defined(AYUMI_NEON) && defined(AYUMI_SAMPLE_DOUBLE)
+
+INLINE void decimate_neon(const double (*x)[2], double* y, const double (*taps)[2], const int n) {
+  int i;
+  float64x2_t acc0 = vdupq_n_f64(0);
+  float64x2_t acc1 = vdupq_n_f64(0);
+  for (i = 1; i < n / 2 - 1; i += 2) {
+    acc0 = vfmaq_f64(acc0, vld1q_f64(taps[i]),
+      vaddq_f64(vld1q_f64(x[i]), vld1q_f64(x[n - i])));
+    acc1 = vfmaq_f64(acc1, vld1q_f64(taps[i + 1]),
+      vaddq_f64(vld1q_f64(x[i + 1]), vld1q_f64(x[n - i - 1])));
+  }
+  acc0 = vfmaq_f64(acc0, vld1q_f64(taps[i]),
+    vaddq_f64(vld1q_f64(x[i]), vld1q_f64(x[n - i])));
+  acc0 = vaddq_f64(acc0, acc1);
+  acc0 = vfmaq_f64(acc0, vld1q_f64(taps[n / 2]), vld1q_f64(x[n / 2]));
+  vst1q_f64(y, acc0);
+}
+
+TIERS(decimate_neon, );
+
+#endif
+
+#if defined(AYUMI_NEON) && defined(AYUMI_SAMPLE_FLOAT)
+
+INLINE void decimate_neon(const float (*x)[2], float* y, const float (*taps)[2], const int n) {
+  int i;
+  float32x4_t b;
+  float32x4_t acc0 = vdupq_n_f32(0);
+  float32x4_t acc1 = vdupq_n_f32(0);
+  float32x2_t acc;
+  for (i = 1; i + 3 < n / 2 - 1; i += 4) {
+    b = vld1q_f32(x[n - i - 1]);
+    acc0 = vfmaq_f32(acc0, vld1q_f32(taps[i]),
+      vaddq_f32(vld1q_f32(x[i]), vextq_f32(b, b, 2)));
+    b = vld1q_f32(x[n - i - 3]);
+    acc1 = vfmaq_f32(acc1, vld1q_f32(taps[i + 2]),
+      vaddq_f32(vld1q_f32(x[i + 2]), vextq_f32(b, b, 2)));
+  }
+  for (; i < n / 2 - 1; i += 2) {
+    b = vld1q_f32(x[n - i - 1]);
+    acc0 = vfmaq_f32(acc0, vld1q_f32(taps[i]),
+      vaddq_f32(vld1q_f32(x[i]), vextq_f32(b, b, 2)));
+  }
+  acc0 = vaddq_f32(acc0, acc1);
+  acc = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+  acc = vfma_f32(acc, vld1_f32(taps[i]), vadd_f32(vld1_f32(x[i]), vld1_f32(x[n - i])));
+  acc = vfma_f32(acc, vld1_f32(taps[n / 2]), vld1_f32(x[n / 2]));
+  vst1_f32(y, acc);
+}
+
+TIERS(decimate_neon, );
+
+#endif
+
+/*
+ * Stem kernels, x points to n frames of AYUMI_STEM_LANES channels, newest
+ * first, and every lane gets the same taps. The scalar kernel is the
+ * reference, the vector one is compiled for each instruction set from the
+ * same lane arithmetic.
+ */
+#define STEM_TIERS(kernel, attributes) \
+  attributes static void kernel##_draft(const double (*x)[AYUMI_STEM_LANES], double* y) { \
+    kernel(x, y, ayumi_fir_taps_draft, FIR_SIZE_DRAFT); \
+  } \
+  attributes static void kernel##_standard(const double (*x)[AYUMI_STEM_LANES], double* y) { \
+    kernel(x, y, ayumi_fir_taps, FIR_SIZE); \
+  } \
+  attributes static void kernel##_high(const double (*x)[AYUMI_STEM_LANES], double* y) { \
+    kernel(x, y, ayumi_fir_taps_high, FIR_SIZE_HIGH); \
+  } \
+  static const ayumi_stem_decimator kernel##_tiers[] = {kernel##_draft, kernel##_standard, kernel##_high}
+
+INLINE void decimate_stems_scalar(const double (*x)[AYUMI_STEM_LANES], double* y,
+  const double (*taps)[2], const int n) {
+  int i, l;
+  double acc[AYUMI_STEM_LANES] = {0};
+  for (i = 1; i < n / 2; i += 1) {
+    for (l = 0; l < AYUMI_STEM_LANES; l += 1) {
+      acc[l] += taps[i][0] * (x[i][l] + x[n - i][l]);
+    }
+  }
+  for (l = 0; l < AYUMI_STEM_LANES; l += 1) {
+    y[l] = acc[l] + taps[n / 2][0] * x[n / 2][l];
+  }
+}
+
+STEM_TIERS(decimate_stems_scalar, );
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+
+/* Two interleaved accumulators hide the add latency */
+INLINE void decimate_stems_vector(const double (*x)[AYUMI_STEM_LANES], double* y,
+  const double (*taps)[2], const int n) {
+  int i;
+  ayumi_stem_lanes acc0 = STEM_LANES(x[0]) * 0;
+  ayumi_stem_lanes acc1 = acc0;
+  for (i = 1; i + 1 < n / 2; i += 2) {
+    acc0 += taps[i][0] * (STEM_LANES(x[i]) + STEM_LANES(x[n - i]));
+    acc1 += taps[i + 1][0] * (STEM_LANES(x[i + 1]) + STEM_LANES(x[n - i - 1]));
+  }
+  for (; i < n / 2; i += 1) {
+    acc0 += taps[i][0] * (STEM_LANES(x[i]) + STEM_LANES(x[n - i]));
+  }
+  STEM_LANES(y) = acc0 + acc1 + taps[n / 2][0] * STEM_LANES(x[n / 2]);
+}
+
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+
+INLINE __attribute__((target("sse2")))
+void decimate_stems_sse2(const double (*x)[AYUMI_STEM_LANES], double* y, const double (*taps)[2], const int n) {
+  decimate_stems_vector(x, y, taps, n);
+}
+
+INLINE __attribute__((target("avx2,fma")))
+void decimate_stems_avx2(const double (*x)[AYUMI_STEM_LANES], double* y, const double (*taps)[2], const int n) {
+  decimate_stems_vector(x, y, taps, n);
+}
+
+STEM_TIERS(decimate_stems_sse2, __attribute__((target("sse2"))));
+STEM_TIERS(decimate_stems_avx2, __attribute__((target("avx2,fma"))));
+
+#endif
+
+#ifdef __aarch64__
+
+STEM_TIERS(decimate_stems_vector, );
+
+#endif
+
+/*
+ * Mono kernels, for chips whose pans all share one left/right ratio. x
+ * points to the history newest first like a stereo lane, r to the same
+ * history oldest first, so that x[n - i] is r[i] and the symmetric taps
+ * fold without reversing a vector. The scalar kernel adds in the order of
+ * the left lane of decimate_scalar() and gives the same bits.
+ */
+#define MONO_TIERS(kernel, attributes) \
+  attributes static ayumi_sample kernel##_draft(const ayumi_sample* x, const ayumi_sample* r) { \
+    return kernel(x, r, Mono_taps_draft, FIR_SIZE_DRAFT); \
+  } \
+  attributes static ayumi_sample kernel##_standard(const ayumi_sample* x, const ayumi_sample* r) { \
+    return kernel(x, r, Mono_taps, FIR_SIZE); \
+  } \
+  attributes static ayumi_sample kernel##_high(const ayumi_sample* x, const ayumi_sample* r) { \
+    return kernel(x, r, Mono_taps_high, FIR_SIZE_HIGH); \
+  } \
+  static const ayumi_mono_decimator kernel##_tiers[] = {kernel##_draft, kernel##_standard, kernel##_high}
+
+INLINE ayumi_sample decimate_mono_scalar(const ayumi_sample* x, const ayumi_sample* r,
+  const ayumi_sample* taps, const int n) {
+  int i;
+  ayumi_accum acc = 0;
+  for (i = 1; i < n / 2; i += 1) {
+    acc += ACCUM_MUL(taps[i], x[i] + r[i]);
+  }
+  return ACCUM_TO_SAMPLE(acc + ACCUM_MUL(taps[n / 2], x[n / 2]));
+}
+
+MONO_TIERS(decimate_mono_scalar, );
+
+#if defined(AYUMI_X86) || defined(AYUMI_NEON)
+
+/* 32 bytes of consecutive taps, split in two on 128-bit instruction sets */
+#define MONO_WIDTH (32 / (int) sizeof(ayumi_sample))
+typedef ayumi_sample ayumi_mono_lanes __attribute__((vector_size(32), aligned(sizeof(ayumi_sample)), may_alias));
+#define MONO_LANES(p) (*(const ayumi_mono_lanes*) (p))
+
+INLINE ayumi_sample decimate_mono_vector(const ayumi_sample* x, const ayumi_sample* r,
+  const ayumi_sample* taps, const int n) {
+  int i, l;
+  ayumi_mono_lanes acc0 = MONO_LANES(taps) * 0;
+  ayumi_mono_lanes acc1 = acc0;
+  ayumi_sample y = 0;
+  for (i = 1; i + MONO_WIDTH * 2 <= n / 2; i += MONO_WIDTH * 2) {
+    acc0 += MONO_LANES(taps + i) * (MONO_LANES(x + i) + MONO_LANES(r + i));
+    acc1 += MONO_LANES(taps + i + MONO_WIDTH) * (MONO_LANES(x + i + MONO_WIDTH) + MONO_LANES(r + i + MONO_WIDTH));
+  }
+  if (i + MONO_WIDTH <= n / 2) {
+    acc0 += MONO_LANES(taps + i) * (MONO_LANES(x + i) + MONO_LANES(r + i));
+    i += MONO_WIDTH;
+  }
+  acc0 += acc1;
+  for (l = 0; l < MONO_WIDTH; l += 1) {
+    y += acc0[l];
+  }
+  for (; i < n / 2; i += 1) {
+    y += taps[i] * (x[i] + r[i]);
+  }
+  return y + taps[n / 2] * x[n / 2];
+}
+
+#endif
+
+#ifdef AYUMI_X86
+
+INLINE __attribute__((target("sse2")))
+ayumi_sample decimate_mono_sse2(const ayumi_sample* x, const ayumi_sample* r, const ayumi_sample* taps, const int n) {
+  return decimate_mono_vector(x, r, taps, n);
+}
+
+INLINE __attribute__((target("avx2,fma")))
+ayumi_sample decimate_mono_avx2(const ayumi_sample* x, const ayumi_sample* r, const ayumi_sample* taps, const int n) {
+  return decimate_mono_vector(x, r, taps, n);
+}
+
+MONO_TIERS(decimate_mono_sse2, __attribute__((target("sse2"))));
+MONO_TIERS(decimate_mono_avx2, __attribute__((target("avx2,fma"))));
+
+#endif
+
+#ifdef AYUMI_NEON
+
+MONO_TIERS(decimate_mono_vector, );
+
+#endif
+
+static int is_supported(int simd) {
+  switch (simd) {
+  case AYUMI_SIMD_SCALAR:
+    return 1;
+#ifdef AYUMI_X86
+  case AYUMI_SIMD_SSE2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+  case AYUMI_SIMD_AVX2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#ifdef AYUMI_SAMPLE_DOUBLE
+  case AYUMI_SIMD_AVX512:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma");
+#endif
+#endif
+#ifdef AYUMI_NEON
+  case AYUMI_SIMD_NEON:
+    return 1;
+#endif
+  }
+  return 0;
+}
+
+int ayumi_decimator_select(int simd) {
+  if (simd == AYUMI_SIMD_AUTO || simd > AYUMI_SIMD_NEON) {
+    simd = AYUMI_SIMD_NEON;
+  } else if (simd < AYUMI_SIMD_SCALAR) {
+    simd = AYUMI_SIMD_SCALAR;
+  }
+  while (!is_supported(simd)) {
+    simd -= 1;
+  }
+  return simd;
+}
+
+ayumi_decimator ayumi_decimator_get(int simd, int quality) {
+  switch (simd) {
+#ifdef AYUMI_X86
+  case AYUMI_SIMD_SSE2:
+    return decimate_sse2_tiers[quality];
+  case AYUMI_SIMD_AVX2:
+    return decimate_avx2_tiers[quality];
+#ifdef AYUMI_SAMPLE_DOUBLE
+  case AYUMI_SIMD_AVX512:
+    return decimate_avx512_tiers[quality];
+#endif
+#endif
+#ifdef AYUMI_NEON
+  case AYUMI_SIMD_NEON:
+    return decimate_neon_tiers[quality];
+#endif
+  }
+  return decimate_scalar_tiers[quality];
+}
+
+/* Four lanes fill an AVX2 vector, AVX-512 has nothing to add */
+ayumi_stem_decimator ayumi_stem_decimator_get(int simd, int quality) {
+  switch (simd) {
+#if defined(__x86_64__) || defined(__i386__)
+  case AYUMI_SIMD_SSE2:
+    return decimate_stems_sse2_tiers[quality];
+  case AYUMI_SIMD_AVX2:
+  case AYUMI_SIMD_AVX512:
+    return decimate_stems_avx2_tiers[quality];
+#endif
+#ifdef __aarch64__
+  case AYUMI_SIMD_NEON:
+    return decimate_stems_vector_tiers[quality];
+#endif
+  }
+  return decimate_stems_scalar_tiers[quality];
+}
+
+/* 32-byte vectors, AVX-512 has nothing to add */
+ayumi_mono_decimator ayumi_mono_decimator_get(int simd, int quality) {
+  switch (simd) {
+#ifdef AYUMI_X86
+  case AYUMI_SIMD_SSE2:
+    return decimate_mono_sse2_tiers[quality];
+  case AYUMI_SIMD_AVX2:
+  case AYUMI_SIMD_AVX512:
+    return decimate_mono_avx2_tiers[quality];
+#endif
+#ifdef AYUMI_NEON
+  case AYUMI_SIMD_NEON:
+    return decimate_mono_vector_tiers[quality];
+#endif
+  }
+  return decimate_mono_scalar_tiers[quality];
+}
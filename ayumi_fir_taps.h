@@ -0,0 +1,99 @@
+/* Symmetric low-pass taps 0..FIR_SIZE / 2, included with TAP defined */
+
+  TAP(0.0),
+  TAP(-0.0000046183113992051936),
+  TAP(-0.00001117761640887225),
+  TAP(-0.000018610264502005432),
+  TAP(-0.000025134586135631012),
+  TAP(-0.000028494281690666197),
+  TAP(-0.000026396828793275159),
+  TAP(-0.000017094212558802156),
+  TAP(0.0),
+  TAP(0.000023798193576966866),
+  TAP(0.000051281160242202183),
+  TAP(0.00007762197826243427),
+  TAP(0.000096759426664120416),
+  TAP(0.00010240229300393402),
+  TAP(0.000089344614218077106),
+  TAP(0.000054875700118949183),
+  TAP(0.0),
+  TAP(-0.000069839082210680165),
+  TAP(-0.0001447966132360757),
+  TAP(-0.00021158452917708308),
+  TAP(-0.00025535069106550544),
+  TAP(-0.00026228714374322104),
+  TAP(-0.00022258805927027799),
+  TAP(-0.00013323230495695704),
+  TAP(0.0),
+  TAP(0.00016182578767055206),
+  TAP(0.00032846175385096581),
+  TAP(0.00047045611576184863),
+  TAP(0.00055713851457530944),
+  TAP(0.00056212565121518726),
+  TAP(0.00046901918553962478),
+  TAP(0.00027624866838952986),
+  TAP(0.0),
+  TAP(-0.00032564179486838622),
+  TAP(-0.00065182310286710388),
+  TAP(-0.00092127787309319298),
+  TAP(-0.0010772534348943575),
+  TAP(-0.0010737727700273478),
+  TAP(-0.00088556645390392634),
+  TAP(-0.00051581896090765534),
+  TAP(0.0),
+  TAP(0.00059548767193795277),
+  TAP(0.0011803558710661009),
+  TAP(0.0016527320270369871),
+  TAP(0.0019152679330965555),
+  TAP(0.0018927324805381538),
+  TAP(0.0015481870327877937),
+  TAP(0.00089470695834941306),
+  TAP(0.0),
+  TAP(-0.0010178225878206125),
+  TAP(-0.0020037400552054292),
+  TAP(-0.0027874356824117317),
+  TAP(-0.003210329988021943),
+  TAP(-0.0031540624117984395),
+  TAP(-0.0025657163651900345),
+  TAP(-0.0014750752642111449),
+  TAP(0.0),
+  TAP(0.0016624165446378462),
+  TAP(0.0032591192839069179),
+  TAP(0.0045165685815867747),
+  TAP(0.0051838984346123896),
+  TAP(0.0050774264697459933),
+  TAP(0.0041192521414141585),
+  TAP(0.0023628575417966491),
+  TAP(0.0),
+  TAP(-0.0026543507866759182),
+  TAP(-0.0051990251084333425),
+  TAP(-0.0072020238234656924),
+  TAP(-0.0082672928192007358),
+  TAP(-0.0081033739572956287),
+  TAP(-0.006583111539570221),
+  TAP(-0.0037839040415292386),
+  TAP(0.0),
+  TAP(0.0042781252851152507),
+  TAP(0.0084176358598320178),
+  TAP(0.01172566057463055),
+  TAP(0.013550476647788672),
+  TAP(0.013388189369997496),
+  TAP(0.010979501242341259),
+  TAP(0.006381274941685413),
+  TAP(0.0),
+  TAP(-0.007421229604153888),
+  TAP(-0.01486456304340213),
+  TAP(-0.021143584622178104),
+  TAP(-0.02504275058758609),
+  TAP(-0.025473530942547201),
+  TAP(-0.021627310017882196),
+  TAP(-0.013104323383225543),
+  TAP(0.0),
+  TAP(0.017065133989980476),
+  TAP(0.036978919264451952),
+  TAP(0.05823318062093958),
+  TAP(0.079072012081405949),
+  TAP(0.097675998716952317),
+  TAP(0.11236045936950932),
+  TAP(0.12176343577287731),
+  TAP(0.125)
@@ -0,0 +1,33 @@
+/* Symmetric low-pass taps 0..FIR_SIZE_DRAFT / 2, included with TAP defined */
+
+  TAP(0.0),
+  TAP(0.000064436566399461910),
+  TAP(0.00019405290009573035),
+  TAP(0.00035580617325614659),
+  TAP(0.00046098688599922682),
+  TAP(0.00038139320310571784),
+  TAP(-0.00000000000000000051803903545023974),
+  TAP(-0.00071394471623421863),
+  TAP(-0.0016336817531110367),
+  TAP(-0.0024469325361055534),
+  TAP(-0.0027061117334744363),
+  TAP(-0.0019684453027559628),
+  TAP(0.0000000000000000018011497078227709),
+  TAP(0.0030217032348618528),
+  TAP(0.0063955573334969285),
+  TAP(0.0089572440625206844),
+  TAP(0.0093504456004069036),
+  TAP(0.0064750655420042222),
+  TAP(-0.0000000000000000037905952848804611),
+  TAP(-0.0092275073952210237),
+  TAP(-0.019049574733867938),
+  TAP(-0.026259366018744665),
+  TAP(-0.027263415968200054),
+  TAP(-0.019017966408407878),
+  TAP(0.0000000000000000057006868970600647),
+  TAP(0.029076062152670484),
+  TAP(0.065046467025955734),
+  TAP(0.10271743261564960),
+  TAP(0.13586506059011330),
+  TAP(0.15858882772439484),
+  TAP(0.16667280991038341),
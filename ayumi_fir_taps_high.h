@@ -0,0 +1,259 @@
+/* Symmetric low-pass taps 0..FIR_SIZE_HIGH / 2, included with TAP defined */
+
+  TAP(0.0),
+  TAP(-0.000000041770405094815336),
+  TAP(-0.00000010062045650993690),
+  TAP(-0.00000017638383110196924),
+  TAP(-0.00000026741494455981898),
+  TAP(-0.00000037040429554605789),
+  TAP(-0.00000048028159871451553),
+  TAP(-0.00000059022793616924755),
+  TAP(-0.00000069181394734663910),
+  TAP(-0.00000077527516966711451),
+  TAP(-0.00000082992820106178831),
+  TAP(-0.00000084472266136268265),
+  TAP(-0.00000080891437507108718),
+  TAP(-0.00000071283527568622801),
+  TAP(-0.00000054872581493717004),
+  TAP(-0.00000031158677709399748),
+  TAP(0.0000000000000000000095589101747509310),
+  TAP(0.00000038313777244824141),
+  TAP(0.00000083002625367499001),
+  TAP(0.0000013275759192418942),
+  TAP(0.0000018572788081207833),
+  TAP(0.0000023953814701650930),
+  TAP(0.0000029133940822997407),
+  TAP(0.0000033789546388704011),
+  TAP(0.0000037570489762858016),
+  TAP(0.0000040115669077123439),
+  TAP(0.0000041071528215736413),
+  TAP(0.0000040112868227506532),
+  TAP(0.0000036965110935275372),
+  TAP(0.0000031426969349068319),
+  TAP(0.0000023392322520663774),
+  TAP(0.0000012869983537643210),
+  TAP(-0.000000000000000000012191333196543522),
+  TAP(-0.0000014934853943721627),
+  TAP(-0.0000031503639385299061),
+  TAP(-0.0000049128939040453094),
+  TAP(-0.0000067096486008410700),
+  TAP(-0.0000084573226367854815),
+  TAP(-0.000010063391696071421),
+  TAP(-0.000011429591979953533),
+  TAP(-0.000012456138291994070),
+  TAP(-0.000013046551585917605),
+  TAP(-0.000013112920070453037),
+  TAP(-0.000012581375297794124),
+  TAP(-0.000011397528717029010),
+  TAP(-0.0000095315875324841026),
+  TAP(-0.0000069828537217052157),
+  TAP(-0.0000037833087167214160),
+  TAP(-0.000000000000000000040380212086606601),
+  TAP(0.0000042640244602252536),
+  TAP(0.0000088704423259724852),
+  TAP(0.000013648190980345518),
+  TAP(0.000018397882347980033),
+  TAP(0.000022898085261108710),
+  TAP(0.000026913368213237693),
+  TAP(0.000030203897279983355),
+  TAP(0.000032536286358265586),
+  TAP(0.000033695304601707201),
+  TAP(0.000033495964118132569),
+  TAP(0.000031795444695671864),
+  TAP(0.000028504266274683164),
+  TAP(0.000023596098242679870),
+  TAP(0.000017115600721522921),
+  TAP(0.0000091837290889118499),
+  TAP(-0.000000000000000000072776373659632540),
+  TAP(-0.000010158685315641074),
+  TAP(-0.000020942938711707799),
+  TAP(-0.000031939631053661658),
+  TAP(-0.000042684442990081954),
+  TAP(-0.000052677993053729292),
+  TAP(-0.000061405125841668451),
+  TAP(-0.000068356756246658727),
+  TAP(-0.000073053491088987231),
+  TAP(-0.000075070096405448360),
+  TAP(-0.000074059756210904053),
+  TAP(-0.000069776985162041901),
+  TAP(-0.000062098020448973976),
+  TAP(-0.000051037533026219923),
+  TAP(-0.000036760568564052644),
+  TAP(-0.000019588755503780331),
+  TAP(0.00000000000000000051406696772048550),
+  TAP(0.000021378878729536378),
+  TAP(0.000043786840847697030),
+  TAP(0.000066350600941760478),
+  TAP(0.000088113503765545448),
+  TAP(0.00010807057256318054),
+  TAP(0.00012520866144459281),
+  TAP(0.00013855032487556366),
+  TAP(0.00014719973734990169),
+  TAP(0.00015038877058283487),
+  TAP(0.00014752117862614714),
+  TAP(0.00013821276557438809),
+  TAP(0.00012232542558983405),
+  TAP(0.000099993056920230888),
+  TAP(0.000071637562501488698),
+  TAP(0.000037973457315419078),
+  TAP(-0.00000000000000000024778408255127494),
+  TAP(-0.000041019758225563981),
+  TAP(-0.000083593076360671052),
+  TAP(-0.00012604426682561308),
+  TAP(-0.00016657296811324168),
+  TAP(-0.00020332224272500825),
+  TAP(-0.00023445423660716660),
+  TAP(-0.00025823063779789151),
+  TAP(-0.00027309476124360947),
+  TAP(-0.00027775178822836075),
+  TAP(-0.00027124352366154057),
+  TAP(-0.00025301401907795609),
+  TAP(-0.00022296255447744808),
+  TAP(-0.00018148078243656430),
+  TAP(-0.00012947131052238627),
+  TAP(-0.000068345622748708243),
+  TAP(0.00000000000000000039973274617236314),
+  TAP(0.000073231031767373485),
+  TAP(0.00014864324940945539),
+  TAP(0.00022325181139659644),
+  TAP(0.00029389841255761628),
+  TAP(0.00035737311275128413),
+  TAP(0.00041054657756124695),
+  TAP(0.00045050773967020470),
+  TAP(0.00047470133079951122),
+  TAP(0.00048105938117713271),
+  TAP(0.00046812066468656310),
+  TAP(0.00043513220284544050),
+  TAP(0.00038212733930573841),
+  TAP(0.00030997555742689228),
+  TAP(0.00022040012385705562),
+  TAP(0.00011596077649967381),
+  TAP(-0.00000000000000000060089717547494539),
+  TAP(-0.00012344710014292040),
+  TAP(-0.00024977775758446800),
+  TAP(-0.00037397818975164372),
+  TAP(-0.00049080723598371109),
+  TAP(-0.00059500086608178110),
+  TAP(-0.00068149018171768450),
+  TAP(-0.00074562452053931973),
+  TAP(-0.00078339055942077090),
+  TAP(-0.00079161794685050717),
+  TAP(-0.00076816201034635471),
+  TAP(-0.00071205450395231840),
+  TAP(-0.00062361418804467432),
+  TAP(-0.00050451025632615204),
+  TAP(-0.00035777321284518324),
+  TAP(-0.00018774970768420068),
+  TAP(0.00000000000000000084911643687341452),
+  TAP(0.00019886094652258042),
+  TAP(0.00040137530760044548),
+  TAP(0.00059950134158287159),
+  TAP(0.00078491129400514315),
+  TAP(0.00094931804484477621),
+  TAP(0.0010848185159058900),
+  TAP(0.0011842404996641582),
+  TAP(0.0012414787012813712),
+  TAP(0.0012518054644196379),
+  TAP(0.0012121419210283765),
+  TAP(0.0011212761847473030),
+  TAP(0.00098001669155402911),
+  TAP(0.00079127084867360606),
+  TAP(0.00056004172680318778),
+  TAP(0.00029333854013747774),
+  TAP(-0.0000000000000000011350309194580030),
+  TAP(-0.00030956682139128615),
+  TAP(-0.00062372585759031419),
+  TAP(-0.00093001983740654442),
+  TAP(-0.0012156333670328516),
+  TAP(-0.0014678952264780573),
+  TAP(-0.0016748013685201298),
+  TAP(-0.0018255383153265975),
+  TAP(-0.0019109856002615766),
+  TAP(-0.0019241756793882086),
+  TAP(-0.0018606903875974402),
+  TAP(-0.0017189745532113327),
+  TAP(-0.0015005497914886529),
+  TAP(-0.0012101147142304480),
+  TAP(-0.00085552172627629294),
+  TAP(-0.00044762510309363622),
+  TAP(0.0000000000000000014418906661811970),
+  TAP(0.00047146274882620685),
+  TAP(0.00094907592452361919),
+  TAP(0.0014139740947902188),
+  TAP(0.0018468107205852579),
+  TAP(0.0022285101129230485),
+  TAP(0.0025410467859692896),
+  TAP(0.0027682223302466767),
+  TAP(0.0028964085932242601),
+  TAP(0.0029152258059985704),
+  TAP(0.0028181253928351510),
+  TAP(0.0026028495561232589),
+  TAP(0.0022717433039657490),
+  TAP(0.0018318992919712080),
+  TAP(0.0012951215468318519),
+  TAP(0.00067770064376144524),
+  TAP(-0.0000000000000000017467498216491057),
+  TAP(-0.00071413963275254830),
+  TAP(-0.0014381629214179127),
+  TAP(-0.0021437081615290434),
+  TAP(-0.0028016324559134898),
+  TAP(-0.0033831194920741089),
+  TAP(-0.0038608307476894759),
+  TAP(-0.0042100574654956365),
+  TAP(-0.0044098287518750771),
+  TAP(-0.0044439308052183525),
+  TAP(-0.0043017936494273244),
+  TAP(-0.0039792048499832739),
+  TAP(-0.0034788144734792786),
+  TAP(-0.0028104018982900024),
+  TAP(-0.0019908828115170730),
+  TAP(-0.0010440435933322136),
+  TAP(0.0000000000000000020230168946236457),
+  TAP(0.0011056127256710746),
+  TAP(0.0022327008307116603),
+  TAP(0.0033379965185270344),
+  TAP(0.0043765288331185934),
+  TAP(0.0053032354257967181),
+  TAP(0.0060746625714318348),
+  TAP(0.0066506953802506945),
+  TAP(0.0069962566654262490),
+  TAP(0.0070829115702633122),
+  TAP(0.0068903159519747015),
+  TAP(0.0064074497019014354),
+  TAP(0.0056335816105751325),
+  TAP(0.0045789199316661460),
+  TAP(0.0032649122510145837),
+  TAP(0.0017241693387795875),
+  TAP(-0.0000000000000000022440120559809703),
+  TAP(-0.0018544428686165756),
+  TAP(-0.0037773912122020976),
+  TAP(-0.0057000384175750606),
+  TAP(-0.0075484232975131429),
+  TAP(-0.0092455692607000626),
+  TAP(-0.010713816044833964),
+  TAP(-0.011877272867822896),
+  TAP(-0.012664315579012856),
+  TAP(-0.013010046643664987),
+  TAP(-0.012858635758892928),
+  TAP(-0.012165460673761324),
+  TAP(-0.010898972367110836),
+  TAP(-0.0090422160203186518),
+  TAP(-0.0065939490066377476),
+  TAP(-0.0035693091093750924),
+  TAP(0.0000000000000000023869164376854227),
+  TAP(0.0040660237945415942),
+  TAP(0.0085653741330107089),
+  TAP(0.013420534002098387),
+  TAP(0.018541618876714065),
+  TAP(0.023828548430374182),
+  TAP(0.029173568273041905),
+  TAP(0.034464049168475661),
+  TAP(0.039585481227300275),
+  TAP(0.044424573250359291),
+  TAP(0.048872362985144427),
+  TAP(0.052827242732354632),
+  TAP(0.056197806569452759),
+  TAP(0.058905430403259691),
+  TAP(0.060886503975009061),
+  TAP(0.062094244565579451),
+  TAP(0.062500035136918333),
@@ -0,0 +1,99 @@
+#ifndef AYUMI_INTERNAL_H
+#define AYUMI_INTERNAL_H
+
+#include "ayumi.h"
+
+/* Shared between the core and the decimator kernels */
+
+/*
+ * Conversions and products of ayumi_sample values. Fixed point products
+ * are truncated, sums of products are kept in 64 bits until the end.
+ */
+#ifdef AYUMI_SAMPLE_FIXED
+#define AYUMI_FIXED_ONE ((double) (1 << AYUMI_FIXED_BITS))
+#define SAMPLE(x) ((ayumi_sample) ((x) * AYUMI_FIXED_ONE + ((x) < 0 ? -0.5 : 0.5)))
+#define SAMPLE_TO_DOUBLE(x) ((x) / AYUMI_FIXED_ONE)
+#define SAMPLE_MUL(a, b) ((ayumi_sample) (((int64_t) (a) * (b)) >> AYUMI_FIXED_BITS))
+#define ACCUM_MUL(a, b) ((int64_t) (a) * (b))
+#define ACCUM_TO_SAMPLE(x) ((ayumi_sample) ((x) >> AYUMI_FIXED_BITS))
+#define ACCUM_SCALE(x, s) (((x) * SAMPLE(s)) >> AYUMI_FIXED_BITS)
+typedef int64_t ayumi_accum;
+#else
+#define SAMPLE(x) ((ayumi_sample) (x))
+#define SAMPLE_TO_DOUBLE(x) ((double) (x))
+#define SAMPLE_MUL(a, b) ((a) * (b))
+#define ACCUM_MUL(a, b) ((double) (a) * (b))
+#define ACCUM_TO_SAMPLE(x) ((ayumi_sample) (x))
+#define ACCUM_SCALE(x, s) ((x) * (s))
+typedef double ayumi_accum;
+#endif
+
+/* Reference taps in double for the stems, and in ayumi_sample */
+extern const double ayumi_fir_taps[FIR_SIZE / 2 + 1][2];
+extern const double ayumi_fir_taps_draft[FIR_SIZE_DRAFT / 2 + 1][2];
+extern const double ayumi_fir_taps_high[FIR_SIZE_HIGH / 2 + 1][2];
+#ifdef AYUMI_SAMPLE_DOUBLE
+#define ayumi_fir_sample_taps ayumi_fir_taps
+#define ayumi_fir_sample_taps_draft ayumi_fir_taps_draft
+#define ayumi_fir_sample_taps_high ayumi_fir_taps_high
+#else
+extern const ayumi_sample ayumi_fir_sample_taps[FIR_SIZE / 2 + 1][2];
+extern const ayumi_sample ayumi_fir_sample_taps_draft[FIR_SIZE_DRAFT / 2 + 1][2];
+extern const ayumi_sample ayumi_fir_sample_taps_high[FIR_SIZE_HIGH / 2 + 1][2];
+#endif
+
+/*
+ * Renderers written with vector extensions are cloned per ISA on x86, the
+ * widest clone the CPU supports is picked at load time.
+ */
+#if defined(__x86_64__) && defined(__GNUC__)
+#define AYUMI_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define AYUMI_CLONES
+#endif
+
+/* One vector holds the same field of every stem lane */
+typedef double ayumi_stem_lanes __attribute__((vector_size(AYUMI_STEM_LANES * sizeof(double)),
+  aligned(sizeof(double)), may_alias));
+#define STEM_LANES(p) (*(ayumi_stem_lanes*) (p))
+
+/*
+ * Instrumentation of the hot path. Without AYUMI_STATS the macros expand
+ * to nothing and the core is compiled exactly as before.
+ */
+#ifdef AYUMI_STATS
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t ayumi_cycles(void) {
+  return __rdtsc();
+}
+#elif defined(__aarch64__)
+static inline uint64_t ayumi_cycles(void) {
+  uint64_t t;
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (t));
+  return t;
+}
+#else
+#include <time.h>
+static inline uint64_t ayumi_cycles(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+#endif
+#define STATS_MARK(t) ((t) = ayumi_cycles())
+#define STATS_SINCE(ay, field, t) ((ay)->stats.field += ayumi_cycles() - (t))
+#define STATS_ADD(ay, field, n) ((ay)->stats.field += (n))
+#else
+#define STATS_MARK(t) ((void) 0)
+#define STATS_SINCE(ay, field, t) ((void) 0)
+#define STATS_ADD(ay, field, n) ((void) 0)
+#endif
+
+const double* ayumi_dac_table(int is_ym);
+int ayumi_decimator_select(int simd);
+ayumi_decimator ayumi_decimator_get(int simd, int quality);
+ayumi_mono_decimator ayumi_mono_decimator_get(int simd, int quality);
+ayumi_stem_decimator ayumi_stem_decimator_get(int simd, int quality);
+
+#endif
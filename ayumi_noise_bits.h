@@ -0,0 +1,517 @@
+/*
+ * Output bits of the 17-bit noise LFSR from the power-on state 1, bit i
+ * of the sequence is bit i % 32 of word i / 32.
+ */
+
+  0x80020001, 0x48082004, 0x04a00212, 0x92ca0868, 0x22048126, 0x0a324c88, 0xa86a16e8, 0x4b2eface,
+  0x48090496, 0x24a48210, 0x90d84060, 0x2a6c8586, 0x8b14de42, 0xe4e234ec, 0x5dc6f0fc, 0xb2c7acfc,
+  0x2032c93e, 0x12c80869, 0x6a0ca122, 0x0e924e9a, 0x3aa01e80, 0x692a7be8, 0x423b481e, 0x8cce94f8,
+  0xdbf6baae, 0x62658110, 0xafb05c52, 0x743a748c, 0x77aa757a, 0x39d372be, 0xc4d0fdd2, 0x4f0ef895,
+  0xd8cb0dde, 0x2ea087a4, 0x286816e9, 0x0326daca, 0x4ca90684, 0xb66e8a78, 0xb2dcc146, 0x205ec90e,
+  0x237ec8aa, 0xafccce22, 0x15cff46a, 0x96632eec, 0xb0ea895e, 0x38a48def, 0xe1187f60, 0xea707a76,
+  0x6766ee7c, 0xdbedd714, 0x62098120, 0x9e069c91, 0xb1fa1b8c, 0x6cf7cf8a, 0x951042d2, 0x1d100f64,
+  0x35913d64, 0xb51de646, 0x1f26477c, 0x2d6b7985, 0x777b518c, 0x5a9af328, 0x5fc26393, 0x3af5a874,
+  0x8879fb56, 0xf96072ed, 0x6a17cc98, 0x0efe4eaa, 0x0b16de43, 0xacea14e8, 0x5966f2ee, 0x200da494,
+  0x02364818, 0x18fa44e1, 0xc266b7ca, 0x45bcb454, 0x72a91a16, 0x4d8ef9f8, 0xd2e3087e, 0xa6a2117e,
+  0x50e264ec, 0x8687b5fc, 0xf276acae, 0xc6fdd870, 0x5798bc44, 0x2b1b7ad7, 0xaedc5cf0, 0x419cb60f,
+  0xe26b135e, 0x478afc4c, 0x6a535ef7, 0x8fe84e32, 0x975fbc2a, 0xd40b0b68, 0x1d6c9d14, 0x5464bd82,
+  0x54d4bdd0, 0x961fbc9c, 0xd11f09b8, 0xd96dd679, 0x68218480, 0x16040a4b, 0xc9706989, 0xe956a0bc,
+  0x2bcfe8f8, 0x6d835d6c, 0xd0d54066, 0xbe58559f, 0x9284d326, 0xc33b01a8, 0x80dfb6b8, 0x8b732188,
+  0x857bb43a, 0x8db96ba9, 0xfe3e381c, 0xc71b03f3, 0x101dbff0, 0x8177243c, 0x3dcbe2b3, 0xa4f334e5,
+  0x3983e0da, 0x9597bd67, 0xff078e4a, 0x13ee41ce, 0x3e87e327, 0x19f7f2ae, 0x4640b592, 0x0d66dd11,
+  0x754d1994, 0x4260b7c9, 0x9da4d459, 0x7f491c20, 0xfad0e140, 0xb4ee8b15, 0xb8f4c4e6, 0xa85c5fd4,
+  0x5bf4baaf, 0x2a6da114, 0xab105e40, 0xe6f07ce4, 0x55aef45c, 0x33e13e36, 0x6cbaeb3a, 0x0420025b,
+  0x90c20948, 0x0a0405b4, 0xb8b05689, 0x294a5f4c, 0xc7bdd8c6, 0x528cbe94, 0xef1a31ba, 0x929965f2,
+  0x034c0194, 0xbd04c64b, 0x7fc35548, 0x98f16076, 0x8a4a97de, 0x518ef607, 0xa323377e, 0x66beee8e,
+  0xbc9054d2, 0xb9885604, 0xcdb9dd72, 0xea3ce81d, 0xc6506ef6, 0x5524bd34, 0x51c0bf00, 0x521ef7f1,
+  0xed5a30ba, 0x9bbd61e2, 0x374e5195, 0x2e4da34f, 0x3bd25708, 0xecf47950, 0xed1ea2d5, 0x1aab617a,
+  0xab0733fc, 0x56acbccf, 0x7fd838f2, 0x989d6046, 0xbbfc571d, 0x944e9907, 0xb87e8d8e, 0xca7ddee2,
+  0x6550a664, 0xc31793f5, 0xa06f36ea, 0xdbba28c5, 0xc353019a, 0x21793672, 0x47f34aac, 0xbbb21e1a,
+  0x65735988, 0x339a53ba, 0xed50ebd2, 0xeb96a1f5, 0x20e3edc8, 0x718189ff, 0xf11e3f63, 0x7b691e7b,
+  0x6a12e808, 0xbeea8ea1, 0x0044926f, 0x81160098, 0x9c496269, 0x78e11f80, 0x440a6ffa, 0x74691916,
+  0x56e2f5c8, 0x8ee5f87d, 0x1379be72, 0x9cd1622d, 0x1a889e96, 0x5b8af3b3, 0x1b9361f7, 0x4ff4b1c2,
+  0x7b2d8c14, 0xeb04e890, 0x22a3ecc8, 0x78a58def, 0xc51c6f62, 0xe8207b7f, 0x2e03ea48, 0xcaef9787,
+  0x6710a764, 0xca3397e5, 0x946d66eb, 0x48f34dc1, 0x874203da, 0x557c2f54, 0x20a77fa7, 0xf0978967,
+  0x6d575d0a, 0x038801fb, 0x2e1887f2, 0xca8397b7, 0x56a667a7, 0x0ff3f8e5, 0x8f30dc1b, 0xe4307dad,
+  0x5e82f16c, 0x2fe3eaa5, 0x4d71943f, 0xc11149bf, 0x68543266, 0x77d58abd, 0x382b725e, 0x232f7e5c,
+  0xde8f0e95, 0xa7d4cabd, 0x552e665c, 0x21eb7f17, 0x45b34bac, 0xb2961a0a, 0x51710989, 0xa0d336be,
+  0xa941e992, 0x9f93b8d3, 0x47b7d8c3, 0x3aa41e82, 0xf93a3be1, 0x4b7b4c3a, 0xa95a8428, 0x9fffb8e3,
+  0x76011800, 0xff647182, 0xe2678111, 0xe7b87c56, 0x709a769e, 0xe5607d12, 0x1bd7f398, 0xcee2b15a,
+  0xe764ee7d, 0x93e5f710, 0x66a98332, 0x0ccc94f9, 0x93fe9aaa, 0x66c58302, 0x3d7a543a, 0x563ef5aa,
+  0x7d9839f2, 0x91b96456, 0x8ffe071c, 0x0707fc03, 0xfc6f8fce, 0xbe78c7c4, 0x0204936f, 0x88320488,
+  0xa84b3268, 0xeba87a84, 0x001b6dba, 0x006c0030, 0x31b6c0c3, 0xc5c06f00, 0x1b5dbaf0, 0xacc3306c,
+  0xd9c0f2b6, 0x7a9fc5f1, 0x6dd6eb98, 0x3186c0d8, 0x05036f6c, 0x745d8b46, 0x1633f5ac, 0xe9ace9eb,
+  0x88296932, 0xa8273258, 0xda1eba47, 0xc5db02ba, 0x1b31bac0, 0x9d75f0af, 0x1c009db6, 0x61c27f01,
+  0xc115dbf4, 0xe846326e, 0x7f9caa9d, 0x198b60de, 0x27b53574, 0xecaf8687, 0xfc74e274, 0xbe14c7f4,
+  0x33b253ac, 0x4df26b88, 0xb3168898, 0x476b4ae8, 0xd9db9f0c, 0x7af3c5c1, 0x5c602b5b, 0xf446afd8,
+  0x1e5ed59c, 0xd89ebb2a, 0xcff3071a, 0x93332c1a, 0xe5ff82aa, 0x99a1f280, 0xdf1dd52b, 0xb18689fc,
+  0x0d024f6c, 0x74d91944, 0x9429f484, 0xc9e54d59, 0x1b0b61b3, 0x2d9d30d4, 0x64ad105d, 0x84fe9071,
+  0x3bb5a8c2, 0x8d6df986, 0x3d613980, 0x5652f59a, 0x4c2ef931, 0x54790b56, 0x94a3bdec, 0xabc4cc6f,
+  0x25af7d78, 0xc4e70235, 0x6fd278f7, 0xb9b4c450, 0xad485d04, 0x9ff5f1c2, 0x16289816, 0xe9c0e9db,
+  0xb99fa9f1, 0x6de75d58, 0xc14300b7, 0x691832d6, 0xc2f14876, 0xe7ea355e, 0x71d6762e, 0x5044bfd9,
+  0xc416b498, 0x9c1bb928, 0x69af5f31, 0xf0278935, 0xaf9c5c46, 0x4488b4df, 0x266a5833, 0x7bcfc54e,
+  0x2883e96c, 0xd0879b27, 0xaf16152e, 0x26a935e9, 0x18ce44f8, 0x92b5f7af, 0x23fc81c6, 0xedcdcf06,
+  0x39ebe0e8, 0x34313dad, 0x3387e56e, 0x2d27ebee, 0xd64dd106, 0xd4539908, 0x6c0b5db3, 0xf6edc314,
+  0xd4d9d060, 0x0e2adc85, 0xc849dfdf, 0x3da3e281, 0x0555b42f, 0xf5038bfe, 0xab5e1747, 0x17cdbc6b,
+  0xde4a2a68, 0x14cc0b06, 0xe27cecab, 0xe7d47c66, 0x412cb65d, 0x20a01212, 0x008a4968, 0x62218136,
+  0x3ea41ccb, 0xe97a32e1, 0x0b7f68aa, 0x3d4a5421, 0x96fdf5c6, 0x12980844, 0x2b49a196, 0xbf921c41,
+  0xf5b150c0, 0x399e560e, 0x55e0bd5b, 0xc2dcfeb9, 0xe75e350e, 0x230d376b, 0x1e040ed9, 0xe9f07b89,
+  0x695ee99c, 0x03ee48ea, 0x7f87c727, 0x19e760ee, 0x1603f5b7, 0x296fe987, 0xe7295884, 0x12d7f798,
+  0xea72a11a, 0x376dae79, 0xdec06300, 0x76ed8a30, 0xdcd8f060, 0x0eae4e87, 0x4a53def7, 0x1dea4633,
+  0x9677bcae, 0x70b98972, 0x15edbd5d, 0x56e82ea0, 0xfece386a, 0x04d4022f, 0xc31d489d, 0xd044f6fd,
+  0xcc179498, 0x9c9f2b2a, 0xebb55e19, 0xd06e2d87, 0x3cbe54c7, 0xc132b653, 0x98d9f229, 0x3aea5785,
+  0x0807fb6e, 0xc09f920e, 0x8e77b118, 0x1139bf72, 0x95f5663d, 0x2e8ace97, 0xc8c396b7, 0x5f8263b7,
+  0x3bf1a8e4, 0x1c79b91f, 0xa0217fed, 0x2a87e84a, 0x48b7dfae, 0x06540342, 0xc9354d3d, 0x58466027,
+  0xb49de69d, 0x193e441c, 0x556af433, 0xa0fd7f8f, 0xd9fa29c5, 0xca77058a, 0x157b6673, 0xd4ba2fa8,
+  0xffa31c5a, 0x117640ae, 0x54ce66b1, 0xa6757caf, 0xe3b2a577, 0x10f1bf89, 0xb2c9e5df, 0xd00b0921,
+  0x0d2c9414, 0x14609912, 0xc0c46dd9, 0x9f1df1b9, 0xb58619fc, 0x0d40066d, 0x35d419d0, 0x040d26dd,
+  0x80744919, 0x59d660f5, 0xf2c4e5d9, 0x443fd938, 0x14bc9970, 0x33b9ac56, 0x1ddd2b9d, 0xa6a97ccd,
+  0x10cf64f8, 0x923165ad, 0xa1e680ee, 0xcd846bb4, 0xaac9e869, 0xb18b3f21, 0x8d344f74, 0x6c027925,
+  0xf6c9c304, 0xc44b9021, 0x4d6af985, 0xc17d498f, 0x59e2f2a5, 0xb215e5bd, 0x2376c8ae, 0x8fec4e30,
+  0x074ffc23, 0xdd4b0f4c, 0x38f88dc4, 0x106dbfcf, 0x40b024c0, 0xc6cb914c, 0x4742fc25, 0x497fdf55,
+  0x216880a0, 0x37b48a8b, 0x9da96284, 0xff7f1c38, 0xe20b8121, 0xd60ebc95, 0xb55a199e, 0xfe3dc7e2,
+  0xb714c3f4, 0x172243ec, 0x9dfb2b8c, 0xfe331c88, 0x572f43ea, 0x09cffb95, 0xe7a311ec, 0x70f676ae,
+  0xd4d6bdd1, 0xde179c98, 0xd5bf0baa, 0x4ba7de11, 0x4a2505a6, 0x1c3646c3, 0x611a7f61, 0xa2785a72,
+  0x63c6ec6e, 0x4927df7c, 0x400d0006, 0x9434d019, 0x19900d64, 0x27d93544, 0xdd194644, 0x39b48d74,
+  0xa5497d04, 0x9f7163c0, 0x9432993e, 0xc9894d69, 0x2abda170, 0xe85d5fd4, 0x7ff0aaad, 0x283da01d,
+  0xe2755a74, 0xf7f23c77, 0x50b7d218, 0x67d43542, 0x492d965d, 0x20248010, 0x82904840, 0x42682584,
+  0xad86144a, 0x6cc0306d, 0xb5ccc2b0, 0x7c6fc6ea, 0xb679e7c4, 0x0280016d, 0x0a2805a0, 0x880296da,
+  0x788a7205, 0x85a16f36, 0xbedfaa2a, 0x70935208, 0xe5447d02, 0x0b45b3d9, 0x8da2945a, 0xee50782d,
+  0xf7a4e734, 0xd1e9d2a0, 0xdab9d7a9, 0xb74cc3dd, 0x7647c34a, 0x3e7b711e, 0x7a0a7368, 0x8f896a96,
+  0x36dd3cf0, 0x0819200d, 0x60e51234, 0xb59a19f3, 0xfd31c652, 0x0b14052f, 0xfce154ed, 0x5c4b46fa,
+  0x34e9af84, 0x40e824e9, 0xa7ae11ea, 0xe4c2a6b7, 0xcd46b0b5, 0xf9cea9dc, 0x08a64dee, 0x72135365,
+  0xef6c78a2, 0x83472503, 0xf528e65f, 0x6bf1171b, 0x497b4d1e, 0xa17a80a8, 0x3ffdaaab, 0xbc097004,
+  0xfbe55710, 0xd02b0933, 0x8dae945c, 0x5e60b836, 0xec64eb59, 0xbf55e3d0, 0x16a2d17e, 0x8be168ed,
+  0x873bb53a, 0x849d6fb9, 0xca3c681d, 0x545266f7, 0x540cbdb0, 0xf5723d1a, 0x5a9fd7b8, 0xefd6a398,
+  0x31a7e458, 0xa585ef26, 0x3c4fe26a, 0x32fb778c, 0x48c26948, 0x678583b4, 0x386e56ea, 0x923fbec7,
+  0x41dd00f0, 0xd369d3cd, 0xd091d209, 0x3f4e5507, 0x0ecdb14f, 0xbbda1e28, 0xc4d5d942, 0xff1a389e,
+  0xd39941f2, 0x035c93d4, 0xed47866e, 0x5bca61de, 0x0a952166, 0xdafdd78f, 0x26588344, 0xeb078527,
+  0x42ae6cce, 0x7e9355f7, 0xdda46282, 0x6b4bcc21, 0xfb9b8c45, 0xf1d789d1, 0x68435fda, 0xc7894a96,
+  0x125dbef0, 0x8853202c, 0x09c9b2b2, 0x37ba51e1, 0x7d92e29a, 0xe192a441, 0x9853bb41, 0x58cbd6b3,
+  0x36a3e7a5, 0x29e5a0ef, 0x8508d9b2, 0x2c73eb53, 0x030893fb, 0x3c12c6d3, 0xe38a3721, 0xe0107ff6,
+  0xce40f824, 0x25e7ef11, 0xf5c1c2b6, 0xe85b16f3, 0xafe9eaa0, 0x25593429, 0xd73143e4, 0xb1b61bae,
+  0xddc30f01, 0x1ad00cf6, 0x2aed3314, 0xb91a1f61, 0xcff9dc72, 0xe318ec0d, 0xf2523ef7, 0xc66dd830,
+  0x15d1bd40, 0x261beed7, 0x8a0e05b1, 0xd098f69f, 0x3f6a5517, 0x1e5ff10e, 0xf89a3b28, 0xcde14f12,
+  0x9b5b28ba, 0x64d91060, 0xd529d084, 0xc9f5df19, 0x4b482196, 0x09940442, 0xf6c9514d, 0xd449d020,
+  0x4c63dd81, 0xc5494bdf, 0x1971bbc0, 0x9451f4bf, 0x2802cdb7, 0xf28b1a05, 0x8504d9b4, 0x9c432b48,
+  0x18c89f96, 0x52aef7a3, 0x2f9131f6, 0xdcbdd4c6, 0x3f3c8e54, 0x9f01f1b6, 0x45f7d9c3, 0x33801a92,
+  0xcd386be0, 0xd832293e, 0xed4b8668, 0xebfaa1c5, 0x11552d0b, 0xb441e6ff, 0xea438593, 0xd7aa2e17,
+  0xb3d21abe, 0xc4754b50, 0x6d9279f7, 0xb090c040, 0x994a0d05, 0x0cbc94c6, 0x52399a56, 0x9dc5f0fd,
+  0xdecb9cfa, 0x26c2ca25, 0xc9670435, 0x590a6097, 0x01b92456, 0xc6ff031c, 0x0793fc41, 0x2e36cec3,
+  0xba3857e0, 0x0342dafe, 0x5d3f4655, 0x612eed31, 0xe2a95a16, 0x048ffdf8, 0xd277083c, 0x74fb5073,
+  0x54a2f4c8, 0x87c1fc6d, 0x277bee73, 0x0f980729, 0x5e999cd6, 0x2f8fea95, 0x7cc754fc, 0x04d126bf,
+  0x73098896, 0xdb16bad1, 0xe1eb80e8, 0x59b0bbad, 0xb359e50d, 0x96520a65, 0x502d0930, 0x55b6f451,
+  0x5380be00, 0x5b3af3e1, 0xd95860bb, 0x08f404e6, 0x735f53d5, 0x5a48ba69, 0x5c866203, 0xa7d1ee2d,
+  0xe53aa657, 0x2ab9333b, 0x684f5fdc, 0x77b98a8d, 0x099db29d, 0xe6ef115c, 0xc5d2b465, 0x0b17fad1,
+  0x8cee94ea, 0x5b74bae6, 0x2865a034, 0x8310dad2, 0x547266e5, 0xd48ebdf8, 0xbf721c3e, 0x763f5138,
+  0xcf9eb1f1, 0x92832cda, 0x232481a6, 0x8ea04e80, 0xb26b3ee8, 0x028a484c, 0x6a0185b6, 0x9ea60e83,
+  0x23725ae5, 0x0ffe4e38, 0x0f06dc03, 0xfceb1dcc, 0x3c62c6ec, 0x224d37dd, 0x1b100c09, 0x2df130e4,
+  0x551bd09e, 0x413eff71, 0x20e81232, 0x21aec9ea, 0xe4a1cb36, 0x2ccd306b, 0x21f812a9, 0x65ffcb8e,
+  0x91a0d280, 0xdf994729, 0x339c88d4, 0x2d4bebde, 0xe7fb11c5, 0x1193f608, 0x7756e743, 0x5a2ef378,
+  0x0d1922d6, 0x74b51974, 0xa59f3447, 0x0c252259, 0x0056db43, 0x815e00b8, 0xbd6de2eb, 0xfe615580,
+  0x5663435a, 0xbceb395e, 0x386256ec, 0x220f7edc, 0x5a1d0c9d, 0xbdd5e2bd, 0x1c8ad4de, 0x03e3fe37,
+  0xffb1c73f, 0x013c008f, 0x74e3c237, 0x24c134ff, 0xb148c0b2, 0xfe378ec3, 0xd73d43e2, 0x0186dbb5,
+  0xc603036c, 0x746c3d86, 0xe6f635c3, 0x85b7b451, 0x3e85aa02, 0x59fef2aa, 0x42642582, 0x1db6d451,
+  0x77003c00, 0xdb70f3c0, 0xb074c03d, 0x8ad44cf4, 0xf3fc771d, 0xb0ce1b07, 0x38348daf, 0xa3517e64,
+  0xe770ee76, 0x43b4b73d, 0x4ae99784, 0xbf08c769, 0xc7d391d3, 0x23337e53, 0x2efeceaa, 0x9914d642,
+  0xadc2146c, 0xfdd470f4, 0x288c84dd, 0x00badb3a, 0xb2e0c15b, 0x50ad0979, 0x57bef571, 0x7b803a92,
+  0xe9b8e9e0, 0x5878291f, 0x846726ee, 0x69dae9d7, 0x91f609c3, 0x5ec74791, 0x8ef16a3f, 0xd32abe5e,
+  0xb198529f, 0xad78cf56, 0x4f34b1af, 0x78218da4, 0x57042e4b, 0xc960fbc9, 0xb915e099, 0x0fc6dc6e,
+  0xffe71c7c, 0x80620037, 0xc98e20dc, 0xdaa0617f, 0xe72b83e8, 0x42dcb79d, 0xef5f150e, 0x2389a569,
+  0x9c1e0ff1, 0xc9b9df3b, 0xfa7ce11d, 0x86544a66, 0xc1346d3d, 0x58c2f225, 0x3687e7b5, 0x3977e0ae,
+  0xc648fcb2, 0x25477d03, 0x674983df, 0x8b529741, 0x35ff7471, 0xc4a22681, 0xdec2b86c, 0x26e6ca35,
+  0xd9f54474, 0x1a4a4597, 0x088db206, 0xa2be1338, 0xb0d3add3, 0xf8438d93, 0x9e8a0e97, 0x13c09ab6,
+  0x5e3e6371, 0x4d1a6bf3, 0x10b80972, 0xa3eba55e, 0x55902f2d, 0x1319be44, 0x1d5762f5, 0xc488fdfb,
+  0x2e6b7833, 0x7b4b574c, 0xaa99e844, 0xf0ce3f95, 0x3c341daf, 0xa3133765, 0xa67deee2, 0xd3906564,
+  0x037893c4, 0xfdd5c62f, 0x188a44de, 0x03a1b736, 0xbebcc7ab, 0x9118d2d6, 0x3d72c677, 0x661c35b9,
+  0x6e1115bf, 0xdea547a6, 0x477f4ae3, 0x098adf21, 0x56b3d177, 0xefa478cb, 0xa06ba4a1, 0x5ba828cd,
+  0xcb1a21ba, 0x00d924f2, 0x43690184, 0x89929608, 0x3ed37141, 0xd8a0f212, 0xff09c769, 0xe3d781d1,
+  0x21637f5a, 0x679bca9e, 0x881696d1, 0xa8db3228, 0xa9e17b80, 0x0d1bf9ba, 0x24be5971, 0xa0b28053,
+  0x18c12949, 0x4288b7b2, 0x3e0a55b3, 0x9bc9f396, 0x769b5161, 0xdd04f090, 0xf9c38d48, 0x98920df7,
+  0x6bc11700, 0x89b84d72, 0xce7ab11e, 0x850d6f6b, 0x8c656b59, 0x0953fbd3, 0x15dad0f3, 0x6636eec3,
+  0x9eb8d5e0, 0x8308dadf, 0x3413e6d3, 0xe30ea523, 0x620a7ede, 0xee095c96, 0xb6c5e790, 0x707bc03a,
+  0x56e8bce9, 0xeecc786b, 0x05dd262b, 0xc7294acd, 0x90d7bf98, 0xea53859a, 0x97eb2e33, 0x96d20a2c,
+  0x52250810, 0x7db670c3, 0xe102a401, 0xda1aba45, 0x55cb42b3, 0x1271bee4, 0xb8e1e07f, 0x58099ffb,
+  0x75a6e611, 0x91c1f624, 0x7e1bc7f3, 0xef8ea3b1, 0x50c264fe, 0x0605b5b4, 0xb8768d8a, 0xea5d5ef0,
+  0x77d0ae2d, 0x883fb255, 0x287d3270, 0xf3731ae5, 0x62fb5a3a, 0x0dc2dd48, 0x67d758f5, 0x2920165b,
+  0x26125808, 0x9a2845a0, 0xc10392da, 0x781e7247, 0x57f82e3b, 0xba9f3a0e, 0x71d51b99, 0x30493fdf,
+  0xc2206c80, 0x84a3b4c8, 0xeac4e86f, 0x25bfef38, 0x94a44210, 0x4bdb4c61, 0x2bd08540, 0xfdff1d55,
+  0xe8238481, 0x5e0c2a4f, 0xcdd06b9b, 0x7b9ca8d4, 0x09cb69de, 0x67b111e4, 0x78bf568e, 0xf576af51,
+  0xda8dd7b0, 0xe79f83b8, 0x1007f6d8, 0xa11fa40e, 0x0e6f6a78, 0x695b5f45, 0xa3f8c8e0, 0x75dcaf0f,
+  0x302f76ce, 0x93bf2c55, 0x57c74391, 0xaa617a7f, 0x0323fe5a, 0xfcbdc68f, 0xbd3cc654, 0x9f20d536,
+  0xe5715989, 0x7b9273be, 0xe9f0e9c0, 0x795ca99d, 0x02e76cee, 0x7bb3c577, 0x5974298b, 0x3047e4b5,
+  0x221bec9e, 0x9a4e0cb1, 0x909cd20f, 0xab7a851e, 0x175dbc2b, 0x9c032b6c, 0x19cc9f06, 0xc6aeb5ea,
+  0x76d03cf6, 0x9c2df014, 0x79751f50, 0x92432cb7, 0x20288016, 0x32a0885b, 0x59a829e9, 0xc33a253a,
+  0xa0db36ba, 0x89616980, 0x8d13b09a, 0x0c9ff963, 0xb2b61a18, 0xd1f309c1, 0xead3179a, 0x85e16f12,
+  0xbfdbaaba, 0xe4931041, 0xbc057002, 0x4bd5970b, 0xcbeb055e, 0xe312a52c, 0x927bbee1, 0xd0c94069,
+  0x4e2995a0, 0xac44cfd9, 0x3bd77398, 0x5ce0b95b, 0xe64ceef9, 0x3757750a, 0x6e28a37b, 0x0e4007db,
+  0x39e41f10, 0xf40e3db1, 0x2f78151f, 0x5f17d52e, 0xd9ae29ea, 0x1b224537, 0xad3b308c, 0x3e3f7138,
+  0xeb1e33f1, 0x12c92cfb, 0x4a082120, 0x0c800692, 0x32c81a20, 0xe80ce922, 0x0eb36a1a, 0x9a269eca,
+  0x213812c4, 0x66f3ca3e, 0x2da0145b, 0x345a5028, 0xf22ce5a2, 0xe79158d2, 0xf03c76c6, 0xbff21c77,
+  0x74375018, 0xe79e3563, 0x200136db, 0xa204c802, 0x02336c88, 0xa8ee84ea, 0xc934fbe6, 0x6840a024,
+  0xb7868a91, 0x156242ec, 0x94df2f9c, 0xca314c89, 0xc46626ee, 0x4ddef9d5, 0x93a608ca, 0x17a243a5,
+  0x9ff32aac, 0xd633981a, 0xe5ad59eb, 0x88efb231, 0x6b3033e4, 0x6a73ccac, 0x1f680e7b, 0xdc56b90a,
+  0xfc9f8fb8, 0x7db7c618, 0xd1046402, 0xd901d649, 0x59974443, 0xd3c4654b, 0xd22dd379, 0x459590d0,
+  0xf20f1a4e, 0x171c989d, 0xbd03abfe, 0x8fde9547, 0x9787bc4a, 0xb7668aee, 0x96ec4314, 0x62dfc863,
+  0x0d52dd08, 0x259e59f1, 0x2420825b, 0x02c00149, 0x0b2c0530, 0x1c02d493, 0x21cb7f05, 0xc5314be4,
+  0xf8963b2e, 0x7dd18f09, 0x809b24d7, 0x0a652110, 0x1932d653, 0xf5587429, 0xba3457e6, 0xb3721ae5,
+  0x46ff4a38, 0x0f92dc41, 0x2eb25cc1, 0x382256c8, 0x230b7e4c, 0xce1d4ed4, 0xe494efbd, 0x5c1af00c,
+  0x45aa6f33, 0xf2f31a3e, 0x64e3595a, 0x75c350fe, 0xb05176f6, 0xaa40ccb6, 0xb3a73e11, 0xb5a68ba7,
+  0x9dc04624, 0x7edd1cf0, 0x2c99a20d, 0xe0af1215, 0xdcb6b975, 0x7f118e40, 0x8bb721e7, 0x1667f583,
+  0x38f9a956, 0x30693fcd, 0x42a26cc8, 0xcea395ec, 0xc6646eef, 0x05f7fd51, 0x37808a92, 0xcd7a22e1,
+  0x993f29aa, 0x7d6f5431, 0xa26ba585, 0x53882c4d, 0x6b1833f2, 0xcad14cf6, 0x47e82716, 0xbbde1e2a,
+  0x54c5994b, 0xf65a3cba, 0xf60d5122, 0x47559199, 0xf9231f7e, 0x0b1e4c0e, 0x9cc8d4fb, 0x4aefdea3,
+  0x6f118764, 0xcab705e7, 0x167767c3, 0x68bae973, 0x14600b5b, 0xd0c62dd8, 0x9e14d5bd, 0xb1b21bac,
+  0x4dd34f08, 0x139008d2, 0x0f7923c4, 0xfd131d2c, 0xdb9d4562, 0xb3ccc1dd, 0x640fcb6a, 0x567fd11c,
+  0x5c98b960, 0x07ab6e17, 0xded70ebc, 0xc6b14a1b, 0xf6ae3cce, 0xa5d210f7, 0x9d1562d0, 0x8d84dd6f,
+  0xbecb3868, 0xb0c05224, 0xc80d4db0, 0xbcb5e219, 0x991cd646, 0x8de2947e, 0xef5478bd, 0x63a4a57d,
+  0x88a8dfa0, 0x9a29f37b, 0xf10552d9, 0x7b051e4b, 0x5ba428cb, 0x7b2ae1a1, 0x1b19289f, 0x2dd530f4,
+  0x458990df, 0x027eda71, 0x29dc8462, 0x45efd9ce, 0x53e19aa4, 0xfab8733b, 0x054a4bde, 0x757d8bc6,
+  0x92a1f7a4, 0xf3adc1eb, 0xc18ddbb0, 0x8a2fb378, 0x601c36d4, 0x7671183f, 0x3ea3717e, 0x1967f2ee,
+  0x0409b496, 0x00664911, 0x519f40d5, 0xd364f759, 0x40a59210, 0x269c1162, 0x6819849f, 0xf6e78a35,
+  0xb4f05076, 0x188e44dc, 0x93b1f73f, 0xb7fcc38f, 0xb48cc206, 0x797bc43a, 0x7278aca9, 0x3ec5386f,
+  0x48f8b23b, 0xd76d43cf, 0x40c3db01, 0x770351b7, 0xbb7d73c6, 0xb6421825, 0x926c4114, 0x7097c043,
+  0x65567d0a, 0x030c93f9, 0xac0286da, 0xeaca3305, 0xc5846f26, 0x8a49fa69, 0x31837601, 0xa515ef66,
+  0x7e06e36e, 0x3ffbe38c, 0x6c103009, 0xf681c324, 0xe56f10a3, 0xcbeab385, 0xd314652f, 0x9160d2ed,
+  0xdc954699, 0x8f9c4e0f, 0xc688fcdf, 0x264b7cb3, 0xdb494504, 0x60918040, 0xf44f1907, 0x0e78958d,
+  0xc905df6f, 0x8887204a, 0xda94f32f, 0xa7fa838c, 0x2595a60b, 0x740fc24e, 0x177ff51c, 0x5c882b20,
+  0x57e82e32, 0xfade3a2a, 0x54d50b0b, 0xa6197c9f, 0xd20465b4, 0xd531d089, 0xa9945f2f, 0x7cc8394d,
+  0xd4ec66a2, 0x6eff5ce3, 0xad128641, 0xae9b3161, 0xb0857690, 0x791d8d2b, 0x23e7ec7c, 0xeda1cf36,
+  0x085d202b, 0xf1f152ad, 0x28da5f9e, 0x81e4db82, 0x0f8d23b0, 0xaecc5cf9, 0x01ddb62b, 0xc76b03cc,
+  0xd1dabf0c, 0x7a7757c3, 0xde7a2a73, 0xd40f0b6a, 0x8d7cdd1d, 0x5d24b9a6, 0x7140ad00, 0xd216bed1,
+  0xc57b90a8, 0x89b9fba9, 0xfe7c711d, 0x86160367, 0x80396da9, 0xc8e6207c, 0x7f16e3f5, 0x7baae1e8,
+  0x191129bf, 0x05d5b466, 0xf70b8ade, 0x835e93d5, 0xa54fa66a, 0x5f6a63cc, 0x985f290e, 0xf8f956a9,
+  0x2c6acfcc, 0x436d93cf, 0x09809600, 0x369a5161, 0xf900e092, 0xfb938c41, 0xd1f709c3, 0x7ac35793,
+  0x8ca16b36, 0x9a4fba6a, 0xa09a120c, 0xa861e912, 0x1b01badb, 0x5db6f0c3, 0x7300ac00, 0xdb32bac1,
+  0xf179c0a9, 0x1af09ead, 0xba6d735d, 0xf2131a41, 0xe76d58a2, 0x83c3b701, 0x7732e777, 0x4bb8b3a9,
+  0xda59459f, 0x24c08224, 0x814e00b1, 0xfd2ce2cf, 0xdb614512, 0xc033001a, 0xaccf306a, 0x69f032ad,
+  0x615fc99c, 0x036adae8, 0xfd9dc60f, 0x39aec45c, 0x8521fd36, 0xacd5eb0b, 0x599af29e, 0x53f26553,
+  0xcaf6b318, 0x2775a750, 0xffa1c736, 0x417d00ab, 0x51e3d2a5, 0xb29177bf, 0xa16cc986, 0xafa5ea82,
+  0x946df4a2, 0x58f10dc0, 0x864b27de, 0x51482d04, 0x603436c2, 0xd6d39865, 0x66235813, 0x7eef55ce,
+  0xac53a265, 0x8b8bb3b3, 0x769675f5, 0x4d30b089, 0xe011c92d, 0xfe463827, 0x26fc831d, 0xf99dc446,
+  0x29eecd5c, 0xc525d9a6, 0x38c53b02, 0x5098bfbb, 0x376b7517, 0x1edb630c, 0x7a803a00, 0xeda8eba0,
+  0x0879203b, 0xe16312ec, 0x6b9a7a9e, 0x88d04dd2, 0x6bcc3394, 0x198c0d6b, 0xd7a8f57b, 0xe3d95abb,
+  0xc158ff44, 0x797672e7, 0xf24eacb1, 0x261e580e, 0x2a1885bb, 0xdac39eb7, 0x16a24337, 0x9be328ec,
+  0x8632913e, 0x80a96de9, 0x8aaf2178, 0x721677f5, 0x5f78b8a9, 0x8815692f, 0xd8d4f22f, 0xaede879c,
+  0x1197f60a, 0xe746a74a, 0x536ef75c, 0x288d3206, 0x30bc1b39, 0xb1fbad57, 0x5cf10f89, 0x960b2ede,
+  0x114c0994, 0xf424e6cb, 0xdfd1d540, 0x02ba4857, 0xaac285da, 0xf1a63f35, 0x99829f25, 0x3f925565,
+  0xfdb070c0, 0x391ac40c, 0xd7fabc73, 0xe2955a0b, 0x747c3d8f, 0xa6b735e7, 0xa0b7a4c3, 0xa8d5e942,
+  0x49dafb9e, 0x13f641c3, 0x5ee66311, 0x2e77ea75, 0x9b38d772, 0x9550d0bf, 0x0c164ff5, 0xa0985b29,
+  0xe868e916, 0x1f252acb, 0x4d66f983, 0x714d8994, 0x4222fec8, 0xdca9d4cd, 0xef6dce79, 0xb341e500,
+  0xf6338a53, 0x67ad11eb, 0x88ce96b1, 0xcbb6b3ae, 0x2261a580, 0x3ba08c5b, 0x7d3839a9, 0x1333653e,
+  0xedfea2aa, 0x99256082, 0x5d07d403, 0x91cf2d4e, 0x9e2047ed, 0xf1631bc8, 0x2a9a5e9e, 0x88c0df92,
+  0x3b8f73b1, 0x3d8539fd, 0x45ccb46b, 0xb36e1aea, 0xb68e8a07, 0x3152c0be, 0xd65e2ef1, 0xe41d592b,
+  0x4e34b13d, 0x7c318fe4, 0x0705276f, 0xac64cfcb, 0xbb5573d0, 0x16e0987f, 0xcaec6879, 0x171f6763,
+  0xcd0c6bf9, 0x88e1695b, 0x8b0bb3fa, 0x749e74d5, 0x6530341b, 0x5293d32c, 0x7f667183, 0xaa6fa115,
+  0xe3187e44, 0xe2507ef6, 0xc764fc34, 0x11e5bf10, 0x6688a7b2, 0xac4a14b3, 0xdbecf386, 0x420d0122,
+  0x9c14d499, 0xb9921f2c, 0xedd15d40, 0xd99860d6, 0x0bf80556, 0xcf5f950e, 0xb18bad68, 0x9d360f75,
+  0x6d0b5d21, 0xf2fdc154, 0x84d8d944, 0x6b2ee887, 0xca094c96, 0x2485a690, 0x305ec02a, 0x627eecaa,
+  0xafdc5c62, 0x458cb44f, 0xb26a1a7a, 0x228ec84e, 0x6813cdbe, 0x96ce0a23, 0xa254c82f, 0x43766c3c,
+  0x19eed631, 0x0625b5a6, 0x38f48dc2, 0xa05d7fd4, 0x5b7028ad, 0xa877a03c, 0x8b59faf2, 0x75d27465,
+  0xd014f6d0, 0x8d52942c, 0x2d9f79f1, 0x24a41059, 0x80da0061, 0x2b65a182, 0x8f20dc12, 0xa4717d89,
+  0x7b82e1fe, 0xb9b3a9e5, 0x5d559d0b, 0x90832dfe, 0x2b048526, 0x2ea25cc8, 0x786356ec, 0x060b6ede,
+  0x584d0d94, 0xf4b0e689, 0x0d88944d, 0x06fad873, 0xab84cc4b, 0x24ab7de8, 0x50e7407c, 0x369375f7,
+  0xf924e082, 0xeb01cc00, 0x92b72cc3, 0x73f7c1c3, 0xe8e07b12, 0x2d0febf8, 0x76ef515c, 0x8cd3b065,
+  0x0b83fa93, 0x5eb7d5e7, 0x5f342ac2, 0x2923e9a5, 0x561d980f, 0x9d17b9bc, 0xdd8f9d6a, 0xbbe68c7c,
+  0xa4245934, 0x8ad32141, 0x03e1b712, 0xbfb8c73b, 0x0518909f, 0x6433cb77, 0x268c116b, 0x285884bb,
+  0xd3e79aa7, 0x22a01336, 0x08aa4de8, 0xc223937e, 0xf4ac74cf, 0xedfb1473, 0x3933e088, 0x575cbc2b,
+  0xb8073b6e, 0x1b9c9e0f, 0x8fcbb1de, 0x67d27c65, 0x9934d650, 0x2d401424, 0xb7d451d0, 0x042c025d,
+  0x20f2c953, 0x11c409d9, 0xd60c67f9, 0xe551599b, 0xfb1073f6, 0xa3f0c8e4, 0x55fc2f1d, 0x22af7e87,
+  0xd8970df5, 0xdfd5470b, 0x82a8485f, 0xa28ba5fa, 0xd0062db5, 0x9d18d40d, 0x0db2dd77, 0xa6105809,
+  0xd22065a4, 0xc5a390c8, 0xead47a2f, 0x75fcaf1d, 0xb0ad7686, 0xd9bf0d71, 0x7b67c511, 0x8a296816,
+  0xa00736d8, 0x7a1ca80f, 0x0fd36abe, 0x1fb09c52, 0xaf39788d, 0x761675bc, 0x4f38b1a9, 0xc8114dbf,
+  0x4cc42226, 0xa7dccab9, 0x750ee64e, 0x336b775e, 0x0e9b6a0c, 0x3a841e90, 0x79b83ba9, 0x017b6d1e,
+  0x85fa02a8, 0xbfb7aa8a, 0xd525d082, 0x79c51f02, 0x50882dfb, 0x67283532, 0x3ad2579a, 0xe8e47b10,
+  0xbd1fabf1, 0x7faf5578, 0xa947a0b5, 0x4f8af8de, 0x4ad34cf7, 0x0fe00712, 0xbf7e1c38, 0xc60f9123,
+  0xd45ebd9c, 0xfc3f1daa, 0xef3f8771, 0xb20de5b0, 0x43174898, 0xb86c56eb, 0xda379ec3, 0x457d02e2,
+  0x41a3dba5, 0xf295532f, 0x357c198f, 0xa6a7a7a7, 0xf0f4e4e6, 0x8cdcddd4, 0xdbbeba8e, 0x43410192,
+  0x29301652, 0x6653582c, 0xbf285532, 0x5753d19a, 0x683a7b73, 0x066a4a7a, 0xf9cf8d4e, 0x28a2cdec,
+  0x70011b6d, 0xe7047c02, 0x0261b7c9, 0xb9a0c45b, 0x7d191d29, 0xb3b5e574, 0xa5eccb86, 0xbdede2a2,
+  0xfc6954a0, 0x7e63c7c8, 0x0e69235f, 0xb9421f48, 0xae9c5cd4, 0x4098b69f, 0x766b5117, 0x1ecbf14c,
+  0x2ac37a25, 0xc9a1df36, 0x9a1d612b, 0xb1d452bd, 0x1c4c0fdd, 0xc0f4ff8b, 0x4fdcb1d4, 0xdb8f0c4e,
+  0xb384c1fd, 0x452b4be8, 0xd0ff9b1c, 0x4ef195c0, 0xcf294e5f, 0xb057ad98, 0x6a5bccba, 0xbfca8e21,
+  0x84d69067, 0x9b172898, 0xd5edd0eb, 0x5ae99ea0, 0xfe08e369, 0xc7c30393, 0x73703e76, 0x0af7fa3c,
+  0x0b709752, 0xfd75543d, 0x8a0205b7, 0x60a83684, 0x24aa597a, 0x70e3c07e, 0x34813dff, 0xf14ce422,
+  0x6a275eca, 0xde3f0ec7, 0x651fcbf1, 0x122ed378, 0x2999a0d6, 0xf4ff1955, 0xccb394c1, 0x8e056a4b,
+  0x80f5ff8b, 0x6bd8a1d6, 0xd9df0d47, 0xfae1c5c9, 0x54290b7b, 0xd5e6bd58, 0x1ac49eb4, 0xeabe3338,
+  0x94532fd3, 0x78098db2, 0xf7a6ae11, 0x91e0d2a4, 0xde9d47b9, 0xa79cca9d, 0x740ae6de, 0xa76b3517,
+  0x57da670c, 0x7a143a42, 0x3ff1aaad, 0x0c39b01f, 0xe0255b7d, 0xbe973843, 0x41b5928b, 0x62cd1306,
+  0x1d189d29, 0x05b3fd77, 0xa694ca0b, 0x503a648c, 0xe5ea347a, 0x79f672ae, 0xf046ad91, 0x0e1edc9c,
+  0x989a9fba, 0x5be3d713, 0x9a31613f, 0x816692ee, 0x4d8c2294, 0x82e8487b, 0xa38fa56a, 0x44066ffc,
+  0xc459d90d, 0x4d22f9a5, 0xe059c90d, 0xdf62b8a5, 0xa07cc91d, 0xebf4e8e6, 0xe16ced14, 0xaba57a82,
+  0x942fbda3, 0x19fc0d54, 0x166ff587, 0x18d92944, 0x22e93784, 0x098a4d68, 0x46b19176, 0xeead5ccf,
+  0xa45fa6f1, 0x1b3b61a8, 0xed5e30b8, 0x0bad21eb, 0x3e0e55b1, 0x0bd9b39f, 0x7fdb5545, 0xf890e040,
+  0xbdca8f05, 0x8cf694e7, 0x3b153ad0, 0x1fe5b8ef, 0x5e68b832, 0xcc446b4b, 0xadd5eb99, 0x5d8af0de,
+  0x03f36c77, 0xaff2871a, 0x25353419, 0xe6878327, 0x747674ae, 0xc69eb5f1, 0xb6133c9a, 0xf32dc1a2,
+  0xc385da90, 0xa22f37ea, 0xd29e2cd5, 0xf751519b, 0xb2305376, 0x03e248ec, 0xcfb7073c, 0x02276c83,
+  0x78bfc4c7, 0xe574ef50, 0xdb84f3b4, 0xe3ab81e8, 0x5094bfbd, 0x875bb50c, 0x051b6f61, 0x143c0b70,
+  0x21b3ed77, 0x34d48b0b, 0x101f649c, 0xd17c6439, 0x38e656a7, 0xb0173ff5, 0x7b5d8c2b, 0x2ac3e86c,
+  0xd9a39f37, 0x9b14452f, 0xb5e050ed, 0x5cdf46b8, 0xe6b0ee89, 0x44a8b4cd, 0xa6e8587b, 0x31cfe46a,
+  0x04236fec, 0xf0cf894e, 0x0c32ddac, 0xa0085b69, 0xaa21e812, 0x1225becb, 0x69b4a0c2, 0xe049c904,
+  0x9f23b881, 0x857cd98f, 0x7da4aba6, 0xf148e420, 0xfa371ec3, 0xd77f0ae3, 0x408bdb21, 0x5627d135,
+  0x3dfd39c6, 0xa42b3485, 0x5aee615c, 0x1e176367, 0xc9bcfbab, 0x4a682116, 0x8d06064a, 0xecc8794d,
+  0x9ded62a2, 0x6e6b5ca1, 0x7f4bc74c, 0xaadba145, 0xb1c33f01, 0xac10cff6, 0xea823325, 0xe4a0efa4,
+  0x0cc9b069, 0x23ea5aa1, 0x6d97cf2e, 0x1086404a, 0x9311652d, 0x257482e6, 0xd78543b4, 0xe36d5aeb,
+  0x9383be01, 0x3736c3e7, 0xdfa863a0, 0xd35b08ba, 0x40599260, 0x5563d0a5, 0xa0d97f9f, 0xc9686984,
+  0x8937208a, 0x1c4ff023, 0xb0fb3f8c, 0x48e34dc8, 0xc70303fe, 0x707c3fc6, 0xb6f73ce7, 0xe0b38053,
+  0x3cc5394b, 0x40d8b6bb, 0x776f5187, 0x8acbb305, 0x73827725, 0x8931fbe4, 0xdc54f02f, 0xbc968fbc,
+  0x79935608, 0xc1d46d42, 0xdb4cf3dd, 0xc087004a, 0xfe14712f, 0x27b083ad, 0x4cb9068d, 0xf62f8a5c,
+  0x97dcd1d4, 0xb60e8a4e, 0x335ac19e, 0xfe5eaa63, 0x569f432a, 0xcf14f899, 0xf0a2adec, 0x1d809d6d,
+  0x67da7c61, 0xb9145642, 0x3fc01c6d, 0xfcfc7070, 0x8c3e06c7, 0x083bfb73, 0xb06c5279, 0xfab78cc3,
+  0xc5754bc2, 0x69827bb7, 0xe091c964, 0xfc4e3907, 0x0efc078f, 0x4b1fde47, 0xa8ce84f8, 0x49b6fbae,
+  0x22408100, 0x9b260c11, 0x352a5085, 0x37fbe71e, 0x4c902209, 0x76898a04, 0xcd4eb0b1, 0xd9ee29ce,
+  0x1a2645a7, 0x393b72c5, 0x677e7c38, 0xab8e1723, 0x5480bdff, 0x474afc21, 0x695f5f47, 0x33e888e9,
+  0x7c9cab2b, 0x15bb661e, 0xd7b62e18, 0x43a3da81, 0xfab557af, 0x957e0bc7, 0x6cafcfa3, 0xf475c274,
+  0xbe9055f6, 0xb1a85284, 0x6dbbcf3a, 0x20348019, 0xc2d14864, 0x67683516, 0x3bd6570a, 0x7ce43959,
+  0xe45ea6f1, 0x3f3f71aa, 0xef0e31b1, 0x42c825df, 0x2f0c1522, 0x0ec095db, 0x2bee5e31, 0xdd079d27,
+  0x99ce0d4e, 0x9ea4d5ef, 0x73791ae0, 0x0ad3fa2c, 0x1be2d713, 0xbe35713d, 0x833693e7, 0x04e926a0,
+  0x93ea08e8, 0xa696832e, 0x10336488, 0xe1cea46a, 0x69267bee, 0xf20b8805, 0x970e9895, 0xb54a8bde,
+  0xae7e87c7, 0x931df762, 0x854602fc, 0xcd4c6bdd, 0x89e569cb, 0x1f0bf1b3, 0x2ddf79d5, 0x25a010c9,
+  0x14da4228, 0x7224ac82, 0xcfb0f8c0, 0xe238ec8d, 0x76c03cff, 0xdc6cf030, 0x5c750fc2, 0x04136ff7,
+  0x300c8922, 0x6332ec1a, 0x1af89ea9, 0x9a4df34f, 0xe0931208, 0xac457902, 0x0bd1b39b, 0x5ffbd557,
+  0xea10e809, 0xf6e2aea5, 0x04e4907d, 0x13dc08f0, 0xbe4de34f, 0x72d35308, 0xec607912, 0x3f47e3d8,
+  0x1eebf15e, 0xaa417a6d, 0x83a1fe12, 0xb6bde7ab, 0x919c40d4, 0xbf68c75f, 0x4655910b, 0xfd331d3e,
+  0x5b1f452a, 0xf9cce0f9, 0x48af4dea, 0x7637c375, 0xffbc71e2, 0x810a0097, 0x6c38a256, 0x4621037f,
+  0xbce61dca, 0xa85616f5, 0x3bdd3ab9, 0x3cc9394d, 0xf0e876a0, 0x6caf5dea, 0xe4778275, 0xbf9971f2,
+  0xb59c50d4, 0x2d28865f, 0x0670911b, 0xc9a54d7d, 0x1a0f6123, 0xb99d729d, 0x3dec1d5d, 0xc46eb4a3,
+  0x7dfc39c6, 0x802f2487, 0x58be6055, 0x57726753, 0xd8bebb38, 0x4f710752, 0xd9330d3e, 0xc95f042a,
+  0xb9e9e0e9, 0x7c391da9, 0x3727e77c, 0xbfede386, 0xf4495020, 0xde61d580, 0xc4614b5b, 0xbdc339da,
+  0x9cd0d4f6, 0x2a8e5e95, 0x58919fbf, 0x17cf6707, 0x8e416a6d, 0x11e1bf12, 0xf698e7bb, 0xa50a1097,
+  0xfe78e356, 0x0604036f, 0x88704d89, 0xe94632fc, 0x7b8ca8dd, 0x498a69fa, 0x42b10176, 0xeeef15ce,
+  0xe552a665, 0x8b1fb3f1, 0xa4cf34f8, 0x497020ad, 0xe15780bc, 0x2b4b7afa, 0xef995c44, 0xf09ce4d4,
+  0x2d7a5d1e, 0x173ed1aa, 0x7d88abb2, 0xc1fa2473, 0xabf7338a, 0x9563bd13, 0xacd8cf9f, 0xc9aeb287,
+  0x4a202136, 0xac2286c8, 0x6a48334d, 0x8f844e02, 0xa6e97ce9, 0x11cb6468, 0x063127e4, 0xf8a78dee,
+  0x8d144f66, 0xec80796d, 0xbcc9e220, 0xe8eb16a1, 0x6d22ebec, 0x6259810d, 0xdf439c25, 0x00fa4957,
+  0xa3e681ca, 0xc5a46f34, 0x0acbfa21, 0x7b835725, 0x89b569e6, 0x5e4ef107, 0x9cdf2b0e, 0xeab15e89,
+  0x446e6fce, 0x65ff59c7, 0x81a29281, 0xde90632d, 0x37a88a84, 0x6dd8a2bb, 0xc1bf00c7, 0x1ae7f311,
+  0x0a31b376, 0xd865d6ef, 0x4c1106d2, 0x54850b26, 0xe75c7c2b, 0x6304376f, 0x1a209ec9, 0xf92072c9,
+  0x6b13cc08, 0x9afe0ce3, 0x5257d343, 0xec7a303a, 0x1f2f63ea, 0x2d4f7995, 0x67e911cd, 0x19dad628,
+  0x56f6f5c3, 0x5eb4b850, 0x3f39aac4, 0x2f1531bd, 0x4ea595ef, 0x1e7c0ee2, 0x0817fb67, 0x80de922a,
+  0xab77a18a, 0x8769fc32, 0x85d16f09, 0x7f18aad6, 0x8b9321f7, 0x06f5b5c2, 0x7bb98c56, 0x395da99d,
+  0x26e37cec, 0x79e3c47e, 0x10112dbf, 0x2145a426, 0x2702cada, 0xce7b07c5, 0xb50baf68, 0x8f7e0755,
+  0x050ffd23, 0xd46f0b5c, 0x0cfaddc5, 0x8324dacb, 0x04a12680, 0xb2ce886a, 0x2016c92e, 0x025a4828,
+  0x294c8422, 0x07a6d8ca, 0x5ee10ea4, 0xde6a2a7a, 0x944e0b4e, 0xa87ccd8f, 0xcb74fae6, 0x6164a434,
+  0x8384da90, 0x862b27e8, 0xd0ce2ddc, 0xbe3455af, 0xa33213e5, 0x06fb6ea8, 0x9b820c48, 0x27b011e4,
+  0x5cbb468c, 0xf726ae58, 0x93e8d384, 0xf69dc32b, 0x151ed09c, 0xf52aaf7a, 0x2bf8171f, 0x4d5fdd0e,
+  0xb1aa89e8, 0x3db08f3f, 0x2519340d, 0xd6354374, 0x25b659e7, 0x84820201, 0x5a402824, 0x6ca4a210,
+  0xb458c260, 0xaa2685a7, 0xe2387ec4, 0x66c27cfe, 0xdd65d434, 0x58410d92, 0x44802692, 0x16489820,
+  0x6846e903, 0x679fca9c, 0x1806d6d8, 0xa19b360c, 0x8c756b50, 0x4912fbf7, 0x30dac061, 0xf066ad83,
+  0x8e9cdcd4, 0xd29abe9e, 0x77435193, 0xba797356, 0x22425a6c, 0xcb2d4c14, 0x3007e491, 0x231fec0e,
+  0x0e4e4ef8, 0xc9dddf0f, 0xebeaa1cc, 0x51142d2f, 0x9141f66d, 0x7c13c6d3, 0xc78e2723, 0xe2407eff,
+  0x8725fc10, 0x34e5af82, 0xf0d8e4f2, 0xbc6e1d87, 0x8a7e97c7, 0x015db662, 0xc56302ec, 0xf9da3b9e,
+  0xc8f54dc2, 0x5f5a63d7, 0x589c2962, 0x97f9671f, 0x969a0a0c, 0x73018892, 0xfb363ac3, 0xf36b88a1,
+  0x12989a0d, 0x3b4be197, 0xbe9b3845, 0xf1855290, 0x790d1f6b, 0x73a4ac59, 0xc9a8fba0, 0x9a39613b,
+  0xa14612fc, 0x5f0c2add, 0xc9c069db, 0x2b9da1f0, 0x6ccf5ddc, 0x65f182ad, 0x6199129f, 0xc07ddb54,
+  0x4df0b0e4, 0xe31dc89d, 0x4246fefc, 0xcd3f941c, 0x382da930, 0xe3347e50, 0xd2e2bea5, 0x96a4d17d,
+  0x53f908e0, 0x8adbb30c, 0x33c37701, 0xac31eb76, 0x4a04b36f, 0xacb28688, 0x28013249, 0x8284da02,
+  0x823b25a8, 0x80cf24f8, 0xdb3061ad, 0xa17280ac, 0x1fdd2ab9, 0xae89784d, 0xb0cd76b0, 0x58390da9,
+  0xa567a67c, 0xffc8e396, 0xc0df0063, 0x9f71f189, 0x8430d93f, 0xc880696d, 0x2e89a320, 0xa8ce16b1,
+  0x59b4bbaf, 0x2349a504, 0x9f120e41, 0x75b919e0, 0x11bff61c, 0x47e42710, 0x0beede31, 0x4f059526,
+  0x98e60dca, 0x3a1657f5, 0x7bf83aa9, 0x085f690e, 0xb1f852a9, 0x2cfecf8e, 0x9134d2c2, 0x0dc00624,
+  0x37dc18f0, 0x2c0da24f, 0x32f65318, 0xd8f62951, 0x7e57c7d1, 0x5eba633a, 0xdf022ada, 0x31f889c4,
+  0x34fdaf8f, 0x90b964c4, 0x8bee055c, 0x5706f527, 0x996bbbcc, 0xbc38548d, 0x1b22d77e, 0xbd39708d,
+  0x3f36553c, 0xef2a31a1, 0x525a659e, 0x6c4c3022, 0x07f4038b, 0x4faf4e15, 0x6a47ccb5, 0x4fbb4e1e,
+  0xba168c98, 0x63fb5aa8, 0x09d2df08, 0x37d651d1, 0x4c242259, 0x2452cb41, 0x830e01b1, 0xf408e6df,
+  0xef631513, 0x537a651e, 0xe8de322a, 0x1df52b8b, 0x060bfc97, 0x484f4d95, 0xf5b9c28d, 0x09bc961d,
+  0x46699116, 0x8dc0dd49, 0x2fdf78f1, 0x2d801449, 0xb4d85060, 0xb82cc486, 0xcb31de52, 0xd07464af,
+  0x1cd6d4f5, 0xf2963e98, 0x55719989, 0xa0917fbf, 0xe84ce906, 0x0fb76a8a, 0x0e26dc83, 0x78791fc4,
+  0x2663eeec, 0x6be9855f, 0x39188d29, 0x97f3bc77, 0xe6b1ca1b, 0x64ac34cf, 0xa4fa1073, 0x39a7e0ca,
+  0x8505fd26, 0xbc47ab4a, 0x1adad79e, 0x5ac6f303, 0xaeb7a33c, 0x9035f6c2, 0x29d48466, 0x65cf59dc,
+  0x416192ed, 0xb190529b, 0x8d584f44, 0x5db4b9e6, 0x3309ac04, 0xdf162ad1, 0xe1a9c9e9, 0x18bdbb39,
+  0x237d3754, 0xdfc30e25, 0x12f00876, 0x8aef215c, 0x73127765, 0xcb78fae0, 0xd154642f, 0x9844d6fd,
+  0xe8971698, 0x1cd52b0b, 0x8299fe9f, 0x524e6595, 0xbc1d700f, 0x2bb4173d, 0xfc6b1d85, 0x3e6ac7cc,
+  0x0a4db34f, 0xa9921608, 0xacd17940, 0xd988f296, 0x5bbb4573, 0xeb56a198, 0x23efec78, 0xcd814f24,
+  0x1add2862, 0xbad9730d, 0xa0c85b04, 0xa92de9a2, 0xae257810, 0x8277b7c3, 0x21f9a472, 0x55f90b8d,
+  0x92bbbe8c, 0xd3c541d9, 0xf229537b, 0x4787d8d8, 0xfa671eee, 0x963a0a57, 0xf18b89fa, 0x99369f75,
+  0x6d491420, 0xb3f0c1c0, 0x14fc0b1d, 0x22bfecc7, 0x88d44dd0, 0xfbdc739d, 0x10cc094f, 0xf23ce5ab,
+  0xa7d058f6, 0xd53c6654, 0x29a25f37, 0x6413592c, 0xb60c5122, 0x6351819b, 0xfb731e77, 0x427b483a,
+  0x8dca9468, 0x4ff6f8e7, 0x3b248c10, 0xef207880, 0x3273e588, 0x7ae8a87b, 0x5c0c2b6b, 0xc5f06f1b,
+  0xdb9eba9c, 0xc3c301da, 0x63303776, 0x4af3deac, 0x9f60475b, 0xf4771918, 0xee9b15f3, 0xb485e690,
+  0x795fc42a, 0x62eaece8, 0x7d851d6f, 0x41cc246b, 0xb32c53eb, 0xf7838a93, 0xa17612e7, 0x9fcf2ab1,
+  0xa6c0586d, 0x916d6430, 0x5ca34681, 0x97472e6e, 0xa468cb5f, 0x2be5a1cb, 0x8d28dd32, 0x8c71f91b,
+  0xc900fbff, 0x3893e041, 0xd1c6bf03, 0x8a0697fc, 0xe0ba368c, 0x2ce3795a, 0x5143d2fe, 0x301b76d7,
+  0xc36c6c30, 0x31877603, 0x3505af6f, 0x7746e74a, 0x1a6ff35c, 0x28193244, 0xe2e55a34, 0xb5bb3d73,
+  0x5db74618, 0x43066c03, 0xd829d6cd, 0xfd25c659, 0xdb454502, 0xd0a1405b, 0xef8f156a, 0x60c4a4fd,
+  0x051ed9b8, 0xb42a8b7a, 0x2be8855f, 0x1d1c9d2b, 0x95a3bd7e, 0xafd4ce2f, 0x75ae745c, 0xa1e33637,
+  0x6d92ebbe, 0xa0928041, 0x98432901, 0x08889696, 0x12aad333, 0xbb81e1ff, 0xd5bf99e3, 0x5ba59e10,
+  0x4b2c21a2, 0x18024493, 0x21893604, 0x843c4b70, 0x68b2e977, 0x34408b49, 0xc2462591, 0xd53cf41d,
+  0x39a01f36, 0x651a7d28, 0xb2385372, 0x23c2c8fe, 0xdd370f75, 0x490f4d23, 0xf0adc05d, 0xcdbddd70,
+  0x7a2ca814, 0xcf106ad2, 0x70b0ade4, 0x15c9bd4d, 0x467a6ee1, 0xbd8e1d6a, 0x0de0947f, 0xa75c58b9,
+  0x6704a76f, 0x1a62d7c8, 0xb82d725d, 0xfb371e51, 0xd36f08a3, 0x108ad205, 0x3323e537, 0x3fbdaa8f,
+  0xbd0d7094, 0x6fe51559, 0x896a0433, 0xcd3eb08e, 0x18292932, 0xe1263658, 0xda8aba05, 0x178243b7,
+  0x1f712ae4, 0x9c33b93e, 0xc90ddf6b, 0xa8a7a058, 0xc814fb66, 0xecd2a22c, 0xad87a291, 0x5cc6f06e,
+  0xb6d7aebc, 0x7033c01a, 0x77cc3c6b, 0x684c326b, 0x17b40a8b, 0x0fab6a85, 0xfe571cbc, 0x46b9033b,
+  0xde8f9cdc, 0xb7d68abc, 0x54274258, 0x25df7d47, 0x052002c9, 0x94d20b08, 0x5a050c90, 0xddb4628b,
+  0x2b0acc05, 0xde9b9cd7, 0x6787ca91, 0x786756ee, 0x961b2ed7, 0x510d09b0, 0xd124f659, 0x49819600,
+  0x129e4163, 0xfb50e19b, 0xb2f68875, 0xc0f54950, 0x7fda71d7, 0xd8946042, 0xbfd8c70d, 0x849e9047,
+  0xba33a81a, 0x536d9aeb, 0x4880b200, 0x368ac321, 0xa943a0b7, 0xdf9ab8d7, 0x439348d3, 0x2a7417c2,
+  0xfb771e75, 0xd26b0833, 0x848a904c, 0x6a62e837, 0x7f2d8e5d, 0xfb44e190, 0x62a7c858, 0xecb55de6,
+  0xcc1e2247, 0x8cb96b3b, 0xfa2e3a5c, 0x971a0ad7, 0x75198bf2, 0x8337b775, 0x24eda6a2, 0x91f840e0,
+  0xaefe878e, 0x9115f642, 0xad46866e, 0x7fce71dc, 0x08c5206f, 0x9398d3bb, 0x375ac3d7, 0xee1ea363,
+  0x169b67ba, 0x5b042890, 0xf9a0e0c9, 0x79198d29, 0xb3f7ac75, 0xe4e1cb12, 0x2dc930fb, 0xb5f850e0,
+  0x3cbec68e, 0xd130f652, 0x99d0d62d, 0x3ede55d5, 0x4894b20b, 0xe6db830c, 0x8503b401, 0x6c5eeb47,
+  0x17be43aa, 0x6f82ea93, 0xe8f384e5, 0x1d412bdb, 0x54d0bdd2, 0x060ffc95, 0xd85f0d9c, 0xfcf9c6a9,
+  0x2c2886cd, 0x0260935b, 0x99a44459, 0x7f0b5521, 0xbbdde1d4, 0x24ca594c, 0xf165c0a6, 0xea815e92,
+  0x84ad6fa2, 0x0aff6871, 0x3b525741, 0xeefc7870, 0xc51e2647, 0xa8297b7b, 0x2a277a58, 0xda3f9ec7,
+  0x655d82f0, 0x5323d3ec, 0xb9bd728f, 0xbd6e1d15, 0x8e6e9587, 0x515cbf46, 0xa06736ee, 0xfb9aa8d7,
+  0xd1d309d3, 0x6a5117d2, 0xcfe14e36, 0x937b2c3a, 0xc4db0228, 0x1f21b880, 0xcd74f98b, 0x7904a9b4,
+  0x6382ec48, 0xd8339fe5, 0xdd4d466b, 0xe8e1cdc9, 0x1d092bfb, 0x75f43d50, 0x808fb695, 0xca36213c,
+  0x347be6e1, 0x42a825e9, 0xae8a15fa, 0xd0c0f6b6, 0x5e0fd5b1, 0xbddfab9c, 0x7ca354c8, 0x1547666e,
+  0xa449efdf, 0x8b632181, 0xc53ab41e, 0xa8b97b3b, 0x686e7b5c, 0xd73f0ac7, 0x418fdbb1, 0xc227937c,
+  0x64bc34c6, 0xe4bb1057, 0x1ca7f058, 0x1355be66, 0xac63a27e, 0x4b48b3df, 0x19964443, 0xf7c07549,
+  0xd07dd270, 0x0cf094e4, 0xe30d5add, 0x1205bed9, 0xe936a08a, 0xaa49e820, 0xb3833e01, 0xa534cbe6,
+  0xde806324, 0x77e98aa0, 0x48d8b229, 0x57ef4387, 0x0ac3fa25, 0x5ba3d737, 0x9b3561af, 0x1566d0a7,
+  0x14cd2f94, 0xc2786ca9, 0xe5c6346e, 0x4944b2fd, 0xa18680d8, 0x4c026b6c, 0x74c98b04, 0xc46ab4a1,
+  0xedec79cf, 0x896f20a3, 0x7d2a7085, 0x137b651e, 0xccda2228, 0x1fa52a82, 0x4f6ef8a3, 0x594d0d06,
+  0xf0a0e4c9, 0x5d899d69, 0x63feec71, 0xa9c45f02, 0x3d8d39f9, 0x65ec3479, 0xa1ee12a3, 0xfda6aba7,
+  0xb940c424, 0xfe971cd1, 0x45b5028b, 0x628f5a07, 0x5c159dbd, 0x95972f2e, 0xef05ce4b, 0x12e765ca,
+  0x3ab3e177, 0x5964bbcb, 0x6004a490, 0x0612d808, 0x082a4da1, 0xc02b925e, 0xdcacf05d, 0x5f790e72,
+  0xb813a92c, 0xdbcf9e23, 0xa282816c, 0xd0222da5, 0x8d8a944c, 0x4ef2f877, 0xaf24ce59, 0xb6617580,
+  0x72e3c15a, 0x3ca1397f, 0x514ef66a, 0xa02f36ce, 0xdabe2855, 0x575343d3, 0x78383b72, 0x07636e7e,
+  0xfdfb8f1e, 0x68318489, 0x56450a6f, 0xec70791b, 0x7f06e3fc, 0x3bebe1cc, 0x3c11392d, 0x9385f726,
+  0xe72f83ea, 0xd2ccf794, 0xe61f112a, 0x061db5b9, 0xd8170dbc, 0xdddd462b, 0xaaa8cccd, 0x1009bffb,
+  0x51266411, 0x118bf605, 0x17376775, 0x6daeeba3, 0xd0614036, 0xec8314da, 0xdcc46226, 0xeeddceb9,
+  0x759ae60c, 0xe1323653, 0x0adbfa28, 0x3bc25701, 0xacb57974, 0xc81eb247, 0x8cfb223a, 0xbb233ac8,
+  0x073ed88e, 0x3c888fb2, 0xc1eab633, 0xfbb473af, 0xb16a8985, 0x3ebc8e8f, 0x9919f2d6, 0x3df65475,
+  0xe4063491, 0x4e58b10d, 0x4d874f27, 0xc2c5486f, 0xb739753b, 0x179643bc, 0xcf206ac9, 0xb073ad88,
+  0x7ac98cfb, 0xfc8aab21, 0x8de20637, 0xff5638bc, 0x62ad8179, 0x8c9cddf0, 0xdababa1e, 0xd74143db,
+  0x70711b52, 0x26c37cfe, 0xf961c436, 0x5a110c9b, 0x0de522a6, 0x074ad8b3, 0x6d5fcf47, 0x33aac1e8,
+  0x3d91abbf, 0x859fb447, 0x9e272a58, 0x017edbc7, 0x25ec82a2, 0xb5ecc2a2, 0xfcedc6a2, 0xfc79c6e0,
+  0x2e2087ed, 0x2a6017c9, 0x2b265e58, 0xfe2b1c85, 0x374ec3dc, 0x3e4fe34e, 0x3adb730c, 0xe8c07b00,
+  0xad8debb0, 0x3cef7078, 0xa07336e5, 0x2bcbe8fa, 0xfd931d65, 0xd9954442, 0x9bcc454f, 0xd68dd16b,
+  0xd75f98b8, 0xd00b9b68, 0x1d2ed415, 0x1569bd16, 0xc4f06f89, 0xdf8eb8dc, 0x93c208fe, 0x06340374,
+  0x48b34de5, 0x8646034a, 0xc17c6d1d, 0x79e672a7, 0xb007adb5, 0x2b1ecc0e, 0x0ecadcfa, 0x4bc7de27,
+  0xcba3057e, 0xc23625ae, 0x14fbf4e1, 0xc2a06cc9, 0x86abb5e8, 0xc2c46cfd, 0x973df539, 0x15840bb4,
+  0xc7486e69, 0x31553f42, 0x3641aeff, 0xea62a113, 0x772cae5d, 0xfbc07392, 0xe0bdc970, 0xccfcf954,
+  0x5f3c2ac6, 0x090369b7, 0x449d9046, 0xd63f981c, 0x559d99f0, 0x932fbe5c, 0x058c0294, 0xa668ca7b,
+  0x23c5a54b, 0x2d2acf7a, 0x4679911f, 0xcd81dd6d, 0x0adf6863, 0xbbd05709, 0xa4fc5954, 0xe9bea0c7,
+  0x88616912, 0x8903b2da, 0x5c9ef047, 0xd7b22e1a, 0xd3b39a88, 0xf3f5538b, 0xb0ea1b17, 0x28a6cdee,
+  0xe0115b64, 0xee447826, 0x27f5a719, 0xfda9c616, 0x697d8439, 0xe361c8a4, 0x33b13e1b, 0x2dffeb8e,
+  0xb5205080, 0x5fd34708, 0x5ab02852, 0xaf6ba3cc, 0x6758350d, 0xfb155766, 0x13e408ef, 0x5eae6331,
+  0x0f536af7, 0x1db89d72, 0x8739fc1f, 0xc4946fbd, 0xce18f80d, 0x44826fb7, 0x56419824, 0x6c627913,
+  0x774fc3dc, 0x1a4bf34c, 0x388b7205, 0xa1a57f34, 0xbc8fab23, 0x39f6563c, 0xf4463d91, 0x0e5c959d,
+  0xd9979f2e, 0xcbc7054a, 0xd3a0657f, 0xc3bb93a8, 0x92d5f799, 0xa27a811e, 0x33cdac6b, 0x4c0a6b68,
+  0x54e90b16, 0xd6eabce8, 0xa6c4586f, 0x017d2439, 0x55e342a5, 0xb2d33ebe, 0xe061c912, 0x3f8138db,
+  0xddfcf0e2, 0x1a2c0c86, 0x5912f2d3, 0x71dae461, 0xf0763fc3, 0xdedf9cf1, 0xf6938a08, 0xe5271083,
+  0xeace3307, 0x55942f2f, 0x8309fe4d, 0x141766d1, 0xe11ced2b, 0x6a627a7e, 0x6f2fce5c, 0xfa4dc594,
+  0x6693ca08, 0xac261483, 0xea5a3345, 0x87cd6e22, 0x87496e69, 0x15512f40, 0x3411aff6, 0xa307a527,
+  0x662eeece, 0xfed955d6, 0xb488c204, 0xe96b8433, 0x7b38a88d, 0x1b5128bf, 0x0cf1b076, 0xc309dadf,
+  0x1017f6d1, 0xe15ea42a, 0x2b6f7aea, 0xff0b1c05, 0xb3dcc1d4, 0x244ecb4e, 0x737fc18e, 0xcac8fa20,
+  0x178f6723, 0x8f456afd, 0x85e1fd5b, 0xafd9eabb, 0xe59a3445, 0xb8317252, 0x0b46de6e, 0xedaf145c,
+  0xe866a035, 0xef1cead4, 0x528265fe, 0x0f21b1a4, 0x8c74dd8b, 0x79143bf4, 0x33c1ac6d, 0xfc3aab73,
+  0x4f29077b, 0xb8568d98, 0x6adf5eb8, 0x3dd08f09, 0xa49f34d5, 0x08352019, 0x5057d267, 0xe45a34ba,
+  0xbf2d71a2, 0xe7471191, 0x6368375f, 0x2b965e0a, 0x3ce01dc9, 0x704e76f8, 0x363d3c8f, 0x8b9721f5,
+  0x96e5f5cb, 0x72f98872, 0x1cc9b94d, 0x62ea7ea1, 0x6d875d6e, 0x40c5006f, 0xb71851bb, 0xb710c3f6,
+  0x873203e5, 0x94bb2fa8, 0xdba70c58, 0x132641a7, 0x1dab6285, 0xb7773c3c, 0xe6ab8333, 0x44c4b4fd,
+  0x975e98b8, 0xf40f8b6a, 0x1f7ed51c, 0x5c0cb922, 0xd5f22f1a, 0xda979e98, 0xc7f7038a, 0x23a37e13,
+  0x6cb7cfae, 0x94144242, 0x89104d2d, 0x6cd03064, 0xf58dc294, 0x596fd678, 0x2029a484, 0x12a40859,
+  0x5bba61e1, 0xcb52219a, 0x21fda470, 0xc5e94b84, 0x9bfbbaa8, 0xf6515109, 0xb6205136, 0x53e341c8,
+  0xaab3333e, 0x0067ffca, 0x619980d6, 0xd07f9b55, 0x4cf994e0, 0xe729cacd, 0x02d5b799, 0xeb7b851e,
+  0x3359ac29, 0x9e532a65, 0x50a99b32, 0xd7acf579, 0x73c91ab2, 0xc818fb60, 0x5ce26237, 0xb647aefc,
+  0x327ac11e, 0x7acca86b, 0x4c9e6b2a, 0x86b04a1b, 0xd2aa2ccc, 0xa78211fe, 0xd47066e4, 0x9c869dfc,
+  0xbbd21e2c, 0xe4f55950, 0xed9a30d7, 0x98b16052, 0x8b4e974e, 0xc58eb44e, 0xfa623a7e, 0x262eca5c,
+  0xfad9c5d6, 0xb4ca8b05, 0xa86684a7, 0xeb1c7ad4, 0x52c02cff, 0x4e2cb130, 0x1c500fd2, 0x30853fb4,
+  0x711cad2b, 0x23637e7e, 0x6fbbce1e, 0x28148499, 0x62d35a2c, 0xad605d12, 0x3f577198, 0x4ea8b17b,
+  0x8e484efb, 0x11c5bf02, 0xe60aa7fa, 0xe64a3597, 0xf74c7506, 0x6245134b, 0x3f301c1b, 0x3f3371ac,
+  0x5f3ef1aa, 0x590829b2, 0x41b02452, 0xc2db930c, 0x1743f501, 0x2c7beb57, 0x232813e9, 0x2e92ce9a,
+  0xa8a21681, 0x68027b6c, 0xe689ca04, 0x844fb4b1, 0xd97a298c, 0xc87f04aa, 0x3d7be2e1, 0x663835a9,
+  0x7e8355fe, 0x9de562a6, 0x4e4bdcb3, 0x6dcbcf05, 0xe1f380e5, 0x39d13b9b, 0x84d9fdd6, 0x4b2a6885,
+  0xc81b049e, 0x2ceda230, 0xb17852e0, 0x2ef6ceae, 0xb9345650, 0xbf421c25, 0xb6fc5154, 0xa09e8047,
+  0x2873e91a, 0x13489afb, 0x7c16e243, 0x779ae728, 0xe91232d3, 0xaad9e860, 0xf1ca3f05, 0xa8345fe6,
+  0xfa523a65, 0xe6edca30, 0x95d9f460, 0x0e3a4ec5, 0x980a9ffa, 0x19aad617, 0x9731f53f, 0xa5b4cbaf,
+  0xdc886204, 0x5fe90e32, 0xfa5aa828, 0xd6cf0a23, 0x8650d82d, 0x41266d35, 0x508bd205, 0x1727f535,
+  0x3dedab86, 0xf46874a0, 0x7ee755ca, 0x8c732277, 0x990bbbfa, 0x3dbe5455, 0xc522b413, 0xc8d8fb0d,
+  0x5fee6387, 0x0a476827, 0xd9b9d61f, 0xbb7cc51d, 0x8644d826, 0x91772d18, 0x7ccbc6b3, 0xa4e3a6a5,
+  0x69c0a0ff, 0xb19e89f1, 0x6d63cf5a, 0x4359019f, 0x49519664, 0x51d340f7, 0x625037d2, 0xcf65dc34,
+  0x11612d12, 0xe492a69a, 0x8c03b001, 0x48cefb07, 0xc7b703ae, 0x22a77e83, 0xf8b78de7, 0xcd554f42,
+  0xc98069ff, 0x2a99a160, 0xf8cf1f95, 0x3cb08fad, 0x2109364d, 0x86344a50, 0x40b26de5, 0x86c29148,
+  0x43666c35, 0x59afd615, 0x2325a534, 0xaea4ce82, 0xb07976e0, 0x0ae24cec, 0xeb27177c, 0xd22e2c87,
+  0x359a50d7, 0xf530e652, 0x0b90972d, 0x7efb55c5, 0x7c02e248, 0xa7cba705, 0xc5522665, 0x191dbbf0,
+  0xa5e7347c, 0xedc2a2b7, 0xe9d6a0f5, 0x29c7e9d8, 0x4583d9fe, 0x62575a67, 0x3f781c3b, 0x1e17f12e,
+  0xd9bebbaa, 0x4b610512, 0x8932041a, 0xac5b3028, 0xbba973a0, 0x651f59b8, 0x022c9379, 0x289084d2,
+  0xf0cb1b05, 0x8c20dda4, 0xa8417b49, 0x8b81fa92, 0x16bff5e3, 0x5b9428d0, 0xbbe9e1cd, 0x74191929,
+  0x9725f534, 0x75e58b82, 0xf0c876b2, 0xec2d5da2, 0xae77a351, 0x9339f772, 0x95d442bd, 0x8e0c4edd,
+  0x80d1ff9b, 0x7b4ae197, 0x9a9f2847, 0xf3d55399, 0x30681b5f, 0x62a6ecca, 0xccb1dde4, 0xce0c6a4f,
+  0x84d16f9b, 0x7b08a896, 0xdb9228d3, 0x63f181c0, 0x79f91f1f, 0x207bed8c, 0x13e808e9, 0xee9ea32a,
+  0x1493669a, 0x7304ac02, 0x4b22fac8, 0xf839c48d, 0x3f648e7d, 0xfe647110, 0xe6778351, 0xb7b97572,
+  0x159e429c, 0xe720ee5b, 0x02f1b789, 0xfbe9c55f, 0x70198929, 0x9767bc35, 0x34e88b16, 0x60eca4eb,
+  0xa5bc59e2, 0xecaaa217, 0x4c60227f, 0xb5468bd8, 0x1e4e47dc, 0x88ddfb0f, 0xebfa338c, 0x01576d0a,
+  0xb548c2fb, 0xee7787c3, 0x97396772, 0x95960bbc, 0xcf014e49, 0x10f52dc2, 0x32dbe5d7, 0xd8422901,
+  0x2c8c8694, 0x10fad23a, 0xf2e4e5cb, 0xc4bdd970, 0x5ebcb854, 0x1f192ad6, 0x3d9539f4, 0x058db44f,
+  0x966e0a78, 0x20dec947, 0x2176c98a, 0x87cc4ab0, 0xa74dee6b, 0x17436748, 0x3c79ab56, 0x222137ed,
+  0x2aa6ccca, 0xe8315fe4, 0x4e466a6e, 0xedfdcf1d, 0xf928e084, 0x5b310c1b, 0x897720ae, 0x1d4bf0b3,
+  0x24fb7dc5, 0x11a240c8, 0x8793272c, 0x3635aec2, 0xbbb5e1e6, 0x856cd986, 0x3de5ab82, 0xd448f4b2,
+  0x6c675d83, 0xc75b03d7, 0x1119bf60, 0x15776675, 0x648aefb3, 0xe4631037, 0x7fca71de, 0x98d56066,
+  0x9ad8d79f, 0x12ced307, 0xaa17a12e, 0x02fffeaa, 0x0bd00540, 0x6ffd1554, 0xe90b8405, 0xfabea855,
+  0xc5514bd2, 0x79103bf6, 0xa3d1ec64, 0xf57aaf57, 0x6abd17ab, 0xfc5f8fd5, 0x7ebbc7a8, 0x6d04a2d9,
+  0x32c2c148, 0x98272935, 0x191ed647, 0xc5eab47a, 0xebf47aaf, 0xf16ead15, 0xaaac5e86, 0x901bbff3,
+  0x596f4431, 0x302be485, 0x13ad2c5d, 0x5f8e63b1, 0x8bc168ff, 0x07b9b572, 0xce9d4e9d, 0xe69cee9d,
+  0x741a749e, 0xf7287532, 0x73d3539a, 0xe8707b52, 0x6f46eafc, 0x7befc55c, 0xa801e924, 0x9a87ba03,
+  0x83b693ae, 0x06e12780, 0xbbea8c7a, 0x1414992f, 0x91132d2c, 0x6d5d8662, 0x73a3c1ec, 0x39b53baf,
+  0x954fbd07, 0x9c6a0fcc, 0x986e9fce, 0x083c96c6, 0x40719276, 0xf5c150ff, 0xf85956f2, 0xaee0cea4,
+  0x216d3679, 0x97a20a81, 0x97f20aac, 0xd6b70a18, 0x67b758c3, 0xa8a61683, 0xf8123b65, 0xefc9ce20,
+  0xa1dba461, 0x9d732bc1, 0xdc1b9dba, 0x6dafcf31, 0xf065c034, 0xee915cd2, 0xd4ac6686, 0x6ffb5c73,
+  0x3912c408, 0xf7da3c61, 0xf0155242, 0x3f541c2f, 0x2ea5317d, 0x887e96e3, 0x097db2e2, 0x656110a4,
+  0x33d2539a, 0xcc746b50, 0x6d16ebf5, 0x328ac168, 0xb903a9b7, 0x9f9e9c47, 0xd78398da, 0x23765ae7,
+  0x9fee0e31, 0x0646d827, 0xd97f0d1c, 0x786bc4a1, 0x3629aecd, 0x4bc421d9, 0xbbacc579, 0xc509d9b2,
+  0x0877fb51, 0x015892f2, 0x7577c2e7, 0xf28877b2, 0xe50959b2, 0x9a75f350, 0x00709276, 0xd1c540fd,
+  0xfa0957fb, 0xe785ca90, 0x306f76ea, 0x92bb2cc5, 0xc3c701d8, 0xf320777f, 0x43b3da88, 0xbaf4578b,
+  0xb07e1b55, 0xfaff8ce3, 0xe451cb40, 0xef0231b7, 0xf2f8e5c4, 0x34cc194f, 0x607ca4ab, 0xe7f558e6,
+  0xe1aa3617, 0x68b27b3e, 0x2442cb48, 0xc34f0195, 0xd108f64d, 0x79335653, 0x435e6c2a, 0xb94c566b,
+  0x5ea59ccb, 0x5f7c2ae2, 0x08076927, 0xd09dd20f, 0x8f7e951c, 0x150dbd22, 0xd5662f58, 0x08cedf95,
+  0xc3b793ae, 0x22e53782, 0xb9ba8d73, 0x5d719d1b, 0x80116dbf, 0x6844a026, 0x2796ca98, 0x1c2246c8,
+  0xb14b3f4c, 0x8e384ec4, 0xd002bffe, 0x1d0ad405, 0x05fbfd57, 0x87b04a89, 0xd6ba2e8c, 0xf78318da,
+  0xb17452e6, 0x9ec60eb5, 0xa2f45a3d, 0xd1fe2d55, 0x7ae75783, 0x9c332b77, 0xd90f9f6a, 0xa9ae845c,
+  0xcc20f936, 0xac41eb49, 0x8bc3b393, 0x57b2f577, 0xcbb0fa89, 0xf278e58d, 0x36c4186f, 0x487c2039,
+  0x557742e7, 0x608a7fb3, 0xe4215936, 0x3ec7714a, 0x08f1b23f, 0xd349d3df, 0x5013d241, 0x754e7423,
+  0x226d37cf, 0x9b920c41, 0x67f111c0, 0x79bb561e, 0x6176ed18, 0x83ccdab0, 0xa70fa76a, 0x564e67dc,
+  0xac5d790f, 0x6bb033ad, 0x687bcd8c, 0x37688ae9, 0x6ed4a30b, 0x7dbfc61c, 0xf124e410, 0xcb81de00,
+  0x12bf65e3, 0x5bd661d1, 0xfae4e159, 0xe43dcb70, 0xdeb4f174, 0x37388ac4, 0x2f91a3bf, 0xccbf94c7,
+  0x3e35aa50, 0x9b35f3e6, 0x056490a6, 0x15c40b90, 0xc64c6ef9, 0xa5557d0b, 0x6f00a3ff, 0xaaf285c1,
+  0x31653f59, 0xf682ae93, 0x856290a5, 0xcddc6b9d, 0xcbac68cf, 0x120b65b3, 0x090d2094, 0xb4a45059,
+  0xc9db0461, 0x2bf1a1c0, 0x5d799d1f, 0xa031edad, 0x7ac4a86f, 0x6cbeeb38, 0x94304252, 0x99820d6c,
+  0x2f901564, 0xfcb954c4, 0x3d2ec65c, 0x9769f516, 0xc4d14b09, 0x7f083896, 0xdbd061d2, 0x22fc8154,
+  0xe9ddcd46, 0x69eae9cc, 0x513509af, 0x31c77627, 0x3401afff, 0xe346a503, 0x432efe5c, 0x68891696,
+  0xa4accb30, 0xb8f9e072, 0x38681fcd, 0x4226feca, 0x4cb994c4, 0xe62dca5d, 0x96d5f5d0, 0xb23a881e,
+  0x73c988fb, 0xd81abb61, 0x5deb4633, 0xb273acac, 0x72e9887b, 0x5c88b969, 0x47ea6e33, 0xfbd71e2e,
+  0x50e1095b, 0xe68a35fa, 0xf44074b6, 0xde45d590, 0xd4f30b1a, 0xfe831cda, 0x95e442a6, 0x4ecf4eb1,
+  0xefd1ce2d, 0xc1ba2457, 0xaaf3331a, 0x0163ff5a, 0xf599c29f, 0x893e9655, 0x0c69b032, 0xa1605bc9,
+  0x0f976a98, 0x8ea4dccb, 0x32793ee0, 0x0ac3686c, 0x4ba19736, 0x9a3c45ab, 0x1152d2f7, 0x545e66f1,
+  0xe43c7dab, 0xeeb23177, 0x3423e6c8, 0x23cda54f, 0x0d0a4f68, 0x54f99956, 0x86a9fccd, 0x82cd6cf9,
+  0x93196529, 0x055402f4, 0xc5054bfd, 0xa8457b4b, 0x1b91ba9b, 0x1ffff1c7, 0x7e003800, 0xffe0e380,
+  0x607d8039, 0xc7f1d8e4, 0xe3b87e1f, 0x60da7f9e, 0xa5645982, 0x8fc72391, 0xc7e0fc7f, 0x83fdfe39,
+  0x47c82704, 0x3b5c1e62, 0x1ec5b86f, 0xdafaba3a, 0xd645434b, 0xe471591b, 0x7f8271fe, 0xb9f1e0e4,
+  0x1c589d9f, 0x00a7ffa7, 0x62958166, 0x6c7f5d8e, 0xa73a83e1, 0x2699a7bb, 0xc80f0495, 0xfcbce21d,
+  0x9d384656, 0x9d329d3e, 0xed195d29, 0xfab4e174, 0xa578cbc4, 0x6fb4a3af, 0xf829c484, 0x7f258e59,
+  0xdb646182, 0x7027c011, 0xa79d7c46, 0x440c26dd, 0xa470591b, 0x5b8661fc, 0xbba1e1ed, 0x553d99ab,
+  0x11a5bf34, 0x678ca722, 0x384a56fa, 0x82adfe86, 0x029d25f0, 0xda5d459d, 0xb4d0c22d, 0x880e0495,
+  0xd8b8f21f, 0x9f68475f, 0xd457990a, 0xfc1b1dba, 0xffadc730, 0xf14dc0b0, 0x4a23dec8, 0xdc2d46cf,
+  0x6d77cf51, 0x930841b2, 0x651182d2, 0xe2171367, 0x367d3cab, 0x8a932165, 0x02e5b782, 0x2bb88572,
+  0x5c599d9f, 0x24a3efa5, 0x60c5806f, 0x251a59ba, 0xb638c372, 0x238081ff, 0x9c3a0fe1, 0xd92b9f7a,
+  0xb93cc41d, 0x8f60dc36, 0xa5757d19, 0xef82a3b7, 0xe0f2a4e5, 0x1dc5b9d9, 0xd6cabcfa, 0x26465827,
+  0x4b7d051d, 0x7943c425, 0x929b2cd7, 0x43450190, 0xb920565b, 0x6f135c08, 0x9abc45e2, 0x135ad3d7,
+  0x7c5ee263, 0x56be67aa, 0x6f9278d3, 0xb8b0c4c0, 0x39481f4d, 0xc6b4fcc2, 0x56b8bcc4, 0xaf8978df,
+  0xb4dd74f0, 0x0838048d, 0xc063927e, 0xfd8870df, 0xd9f94472, 0xaa7a858c, 0x134dbe6b, 0xcc022248,
+  0x7cc8ab04, 0xc4ee26a3, 0x6ff678e7, 0xa9268411, 0xee087804, 0x96c16792, 0x72698832, 0x5e80b849,
+  0x6feaeaa1, 0x4955042f, 0xd1c140ff, 0x6a1917f2, 0xeec5ceb4, 0x15fb663a, 0xd6b22e88, 0xd7a398c8,
+  0xa3f45aaf, 0xd5ee2f15, 0x2ae65ea7, 0xf9371f75, 0xdb4f0c23, 0xb088c04d, 0xf92b8d33, 0x3b3c8c1d,
+  0x8f41f8b6, 0x05f3fd53, 0xa790ca9b, 0xc43a26c5, 0xbcab397a, 0x3966567c, 0xb60f3c95, 0x035c019d,
+  0xfd45c66f, 0x5ac345da, 0x0ea12336, 0x9a6e9eea, 0x001c9246, 0xe073803e, 0x3fc938fb, 0xfcd87060,
+  0x9cac4686, 0x4b7bde73, 0xb958c429, 0x9ef69ce7, 0x72351a50, 0xbff738e7, 0xc4239013, 0xeccc794f,
+  0x0dfd22ab, 0x672b5885, 0x5adfd79c, 0xeed2a308, 0xa5a7a611, 0xfcc4e226, 0x7cdfc6b8, 0x74b2e688,
+  0x4580b449, 0x025ada61, 0x394ec423, 0x06affcce, 0x5ad50cf4, 0x9ef9631f, 0xb20a1a4c, 0xa308c896,
+  0xb613aed3, 0xe32f81a3, 0xc28cfe94, 0xa61b35ba, 0x920d65b0, 0xd1154099, 0xb944566f, 0x7e851cd9,
+  0x4dfc22ab, 0x432f4887, 0x588fd695, 0xa7b7a73c, 0xb4a5e682, 0xf9ddc462, 0x28eacdcc, 0x51259bef,
+  0x61843602, 0x10089b69, 0x7122e413, 0x1399be0d, 0x1f5f63d5, 0xec887969, 0x9ce96232, 0xfa6b1ee8,
+  0x260aca4c, 0xea4b8597, 0xf78aae05, 0xa15212f7, 0x8f5d6af0, 0xe5807d6d, 0x9859f260, 0x38e256a5,
+  0x20077ffc, 0x721d880f, 0x0f57f8bc, 0x9daa9d7a, 0x8f70dc3f, 0xe5347d3d, 0xca82b325, 0x76a2e7a5,
+  0x0de1b0ed, 0x8758d8bb, 0x6516ef67, 0x120ad368, 0x390be097, 0xb7bf3c55, 0xc5870291, 0xea447a6f,
+  0x37b5ae19, 0xbdade286, 0xfd6d5430, 0xea638581, 0x57282e5f, 0xf9d23b9a, 0xe8d5cdd0, 0x4dda6b9e,
+  0x13b408c2, 0x1feb6385, 0xbe53382c, 0xd2a9d332, 0xd78dd1f9, 0xd34f9af8, 0x800a924c, 0x782ae017,
+  0x17292e5f, 0xddd62b98, 0xea85ccd9, 0x04bf6faa, 0x02b64851, 0x1af245c1, 0xea663358, 0xf73eae55,
+  0xf38953b2, 0xc11ddbf0, 0xc866b27c, 0x6d1ca2d4, 0x52a3417e, 0xafa731ee, 0xc466b4a7, 0x5ddcb9d4,
+  0x92af2cce, 0x139641f5, 0xdf6063c9, 0xf0778918, 0xeed95cf2, 0xf588e604, 0xe97b1673, 0x2b7be8a8,
+  0x3f581c29, 0x9e95f166, 0x93be9a8e, 0x67c18392, 0xa97a1673, 0x0f7ff8aa, 0x3d081d20, 0xd7f0f552,
+  0x82bcda1d, 0x62d8a5d6, 0xfd4f1d07, 0x2ae885cd, 0x190c9f6b, 0xc5a2b45a, 0xcad0fa2d, 0x77eee715,
+  0xb8c57226, 0x58999fbb, 0x37efe715, 0x9cc16224, 0x5ac99eb2, 0x7e8ae321, 0x8dc322b7, 0x5fd0b8f6,
+  0x2abfe855, 0xa8545fd0, 0x7bd43abd, 0x38eda95d, 0xe0387fe0, 0x6ee2787e, 0x7d67c67c, 0x12496596,
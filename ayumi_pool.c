@@ -0,0 +1,215 @@
+/* Worker pool for rendering chips in parallel */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include "ayumi_pool.h"
+
+/*
+ * A claim is the run generation, the job count of that run and the next
+ * index in one word, so a worker that claims late can never take an index
+ * of the previous run for one of the next. Between runs the index is
+ * IDLE, past any count, and late claims only move it further.
+ */
+#define INDEX_BITS 32
+#define COUNT_BITS 16
+#define IDLE (UINT64_C(1) << 30)
+#define CLAIM(generation, count, index) \
+  ((uint64_t) (generation) << (INDEX_BITS + COUNT_BITS) | (uint64_t) (count) << INDEX_BITS | (index))
+#define CLAIM_INDEX(claim) ((int) ((claim) & 0xFFFFFFFF))
+#define CLAIM_COUNT(claim) ((int) ((claim) >> INDEX_BITS & 0xFFFF))
+
+/* Polls of done before the caller sleeps until the last job is counted */
+#define SPIN_LIMIT 4096
+
+struct ayumi_pool {
+  pthread_t threads[AYUMI_POOL_MAX_THREADS];
+  int thread_count;
+  sem_t wake;
+  atomic_int quit;
+  _Atomic uint64_t next;
+  atomic_int done; /* jobs of the current run that have finished */
+  atomic_int waiting; /* the caller sleeps on finished */
+  sem_t finished;
+  atomic_int busy; /* a run is in progress */
+  uint64_t generation;
+  ayumi_pool_job job;
+  void* context;
+  int users; /* of the shared pool, under shared_lock */
+};
+
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct ayumi_pool* shared;
+
+/*
+ * Runs jobs until none are left. A valid claim keeps its run waiting until
+ * the job is counted in done, so job and context are those of that run.
+ * Whoever counts the last job wakes the caller if it went to sleep.
+ */
+static void run_jobs(struct ayumi_pool* pool) {
+  uint64_t claim;
+  for (;;) {
+    claim = atomic_fetch_add_explicit(&pool->next, 1, memory_order_acquire);
+    if (CLAIM_INDEX(claim) >= CLAIM_COUNT(claim)) {
+      break;
+    }
+    pool->job(pool->context, CLAIM_INDEX(claim));
+    if (atomic_fetch_add(&pool->done, 1) + 1 == CLAIM_COUNT(claim) && atomic_exchange(&pool->waiting, 0)) {
+      sem_post(&pool->finished);
+    }
+  }
+}
+
+static void* worker(void* arg) {
+  struct ayumi_pool* pool = arg;
+  for (;;) {
+    sem_wait(&pool->wake);
+    if (atomic_load_explicit(&pool->quit, memory_order_acquire)) {
+      break;
+    }
+    run_jobs(pool);
+  }
+  return NULL;
+}
+
+struct ayumi_pool* ayumi_pool_create(int threads) {
+  int i;
+  pthread_attr_t attr;
+  struct sched_param param;
+  struct ayumi_pool* pool;
+  if (threads < 1) {
+    return NULL;
+  }
+  pool = calloc(1, sizeof(struct ayumi_pool));
+  if (!pool) {
+    return NULL;
+  }
+  threads = threads > AYUMI_POOL_MAX_THREADS ? AYUMI_POOL_MAX_THREADS : threads;
+  sem_init(&pool->wake, 0, 0);
+  sem_init(&pool->finished, 0, 0);
+  atomic_init(&pool->quit, 0);
+  atomic_init(&pool->next, CLAIM(0, 0, IDLE));
+  atomic_init(&pool->done, 0);
+  atomic_init(&pool->waiting, 0);
+  atomic_init(&pool->busy, 0);
+  for (i = 0; i < threads; i += 1) {
+    /* Prefer real-time scheduling, fall back to a normal thread if not permitted */
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 10;
+    pthread_attr_setschedparam(&attr, &param);
+    if (pthread_create(&pool->threads[pool->thread_count], &attr, worker, pool) == 0
+      || pthread_create(&pool->threads[pool->thread_count], NULL, worker, pool) == 0) {
+      pool->thread_count += 1;
+    }
+    pthread_attr_destroy(&attr);
+  }
+  if (pool->thread_count == 0) {
+    ayumi_pool_destroy(pool);
+    return NULL;
+  }
+  return pool;
+}
+
+void ayumi_pool_destroy(struct ayumi_pool* pool) {
+  int i;
+  if (!pool) {
+    return;
+  }
+  atomic_store_explicit(&pool->quit, 1, memory_order_release);
+  for (i = 0; i < pool->thread_count; i += 1) {
+    sem_post(&pool->wake);
+  }
+  for (i = 0; i < pool->thread_count; i += 1) {
+    pthread_join(pool->threads[i], NULL);
+  }
+  sem_destroy(&pool->wake);
+  sem_destroy(&pool->finished);
+  free(pool);
+}
+
+/*
+ * The process wide pool, started by the first user and stopped with the
+ * last one. Not for the audio thread, it may create or join threads.
+ */
+struct ayumi_pool* ayumi_pool_acquire(int threads) {
+  struct ayumi_pool* pool;
+  pthread_mutex_lock(&shared_lock);
+  if (!shared) {
+    shared = ayumi_pool_create(threads);
+  }
+  if (shared) {
+    shared->users += 1;
+  }
+  pool = shared;
+  pthread_mutex_unlock(&shared_lock);
+  return pool;
+}
+
+void ayumi_pool_release(struct ayumi_pool* pool) {
+  if (!pool) {
+    return;
+  }
+  pthread_mutex_lock(&shared_lock);
+  pool->users -= 1;
+  if (pool->users == 0) {
+    shared = NULL;
+  } else {
+    pool = NULL;
+  }
+  pthread_mutex_unlock(&shared_lock);
+  ayumi_pool_destroy(pool);
+}
+
+/*
+ * Once the jobs are all claimed, the ones still running are on workers.
+ * The caller polls for a while, then sleeps until the last of them is
+ * counted, so a preempted worker gets the core instead of a spinning
+ * caller. Each time waiting is set, either the caller clears it again or
+ * a worker does and posts once, so every post is waited for.
+ */
+static void wait_jobs(struct ayumi_pool* pool, int count) {
+  int spins = 0;
+  while (atomic_load(&pool->done) < count) {
+    if (spins < SPIN_LIMIT) {
+      spins += 1;
+      continue;
+    }
+    atomic_store(&pool->waiting, 1);
+    if (atomic_load(&pool->done) < count || !atomic_exchange(&pool->waiting, 0)) {
+      sem_wait(&pool->finished);
+    }
+  }
+}
+
+/*
+ * Calls job(context, i) for every i below count, on the workers and the
+ * calling thread, and returns once all of them have finished. Jobs no
+ * worker got to are run by the caller, and while another caller has the
+ * pool all of them are. count must stay below AYUMI_POOL_MAX_JOBS.
+ */
+void ayumi_pool_run(struct ayumi_pool* pool, ayumi_pool_job job, void* context, int count) {
+  int i;
+  if (atomic_exchange_explicit(&pool->busy, 1, memory_order_acquire)) {
+    for (i = 0; i < count; i += 1) {
+      job(context, i);
+    }
+    return;
+  }
+  pool->generation = (pool->generation + 1) & 0xFFFF;
+  pool->job = job;
+  pool->context = context;
+  atomic_store_explicit(&pool->done, 0, memory_order_relaxed);
+  atomic_store_explicit(&pool->next, CLAIM(pool->generation, count, 0), memory_order_release);
+  for (i = 0; i < pool->thread_count && i < count - 1; i += 1) {
+    sem_post(&pool->wake);
+  }
+  run_jobs(pool);
+  wait_jobs(pool, count);
+  atomic_store_explicit(&pool->next, CLAIM(pool->generation, 0, IDLE), memory_order_relaxed);
+  atomic_store_explicit(&pool->busy, 0, memory_order_release);
+}
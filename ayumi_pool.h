@@ -0,0 +1,26 @@
+#ifndef AYUMI_POOL_H
+#define AYUMI_POOL_H
+
+/*
+ * A small set of worker threads for rendering independent chips in
+ * parallel. ayumi_pool_run does not allocate or lock: jobs are claimed
+ * through an atomic counter and workers are woken with a semaphore.
+ * ayumi_pool_acquire hands out one pool shared by the whole process, a
+ * run that finds it busy with another caller does its jobs itself.
+ */
+enum {
+  AYUMI_POOL_MAX_THREADS = 7,
+  AYUMI_POOL_MAX_JOBS = 0xFFFF
+};
+
+typedef void (*ayumi_pool_job)(void* context, int index);
+
+struct ayumi_pool;
+
+struct ayumi_pool* ayumi_pool_create(int threads);
+void ayumi_pool_destroy(struct ayumi_pool* pool);
+struct ayumi_pool* ayumi_pool_acquire(int threads);
+void ayumi_pool_release(struct ayumi_pool* pool);
+void ayumi_pool_run(struct ayumi_pool* pool, ayumi_pool_job job, void* context, int count);
+
+#endif
@@ -0,0 +1,833 @@
+/* Offline renderer for YM, PSG and VGM (AY-3-8910) register dumps */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ayumi.h"
+
+enum {
+  BLOCK_SIZE = 1024,
+  VGM_RATE = 44100,
+  /*
+   * Frames rendered before a segment and thrown away: the FIR and BLEP
+   * history need a few dozen, the boxcar DC filter 1024, and with
+   * AYUMI_COMPACT the one-pole DC filter decays below 1e-7 in 4096.
+   */
+  SEGMENT_WARMUP = 4096
+};
+
+enum {
+  FORMAT_WAV,
+  FORMAT_RAW
+};
+
+struct options {
+  int sample_rate;
+  int format;
+  int remove_dc;
+  int is_eqp;
+  int quality;
+  int engine;
+  double pan[TONE_CHANNELS];
+  double segment; /* seconds, 0 to render each file in one go */
+  const char* output;
+};
+
+struct job {
+  const char* input;
+  char* output;
+  const char* error;
+  double seconds;
+  double elapsed;
+};
+
+/* A register write found by the parse pass */
+struct event {
+  long long position;
+  int reg;
+  int value;
+};
+
+/* Where segment n + 1 starts rendering, SEGMENT_WARMUP frames before its output */
+struct checkpoint {
+  long long position;
+  size_t event;
+  int regs[14];
+  struct ayumi_state state;
+};
+
+struct render {
+  const struct options* opt;
+  struct ayumi ay;
+  int regs[14];
+  int is_ym;
+  double clock_rate;
+  FILE* out;
+  long long position;
+  long long start; /* frames before it are a warm-up and not written */
+  int segmented; /* output goes to its offset in the file */
+  int write_failed;
+  /* Parse pass only: the writes are collected instead of played */
+  int recording;
+  struct event* events;
+  size_t event_count;
+  size_t event_capacity;
+  int out_of_memory;
+  float left[BLOCK_SIZE];
+  float right[BLOCK_SIZE];
+  float frames[BLOCK_SIZE * 2];
+};
+
+static struct options options = {
+  44100, FORMAT_WAV, 1, 0, AYUMI_QUALITY_STANDARD, AYUMI_ENGINE_FIR, {0.1, 0.5, 0.9}, 0, NULL
+};
+
+static struct job* jobs;
+static int job_count;
+static atomic_int next_job;
+
+static uint32_t be32(const uint8_t* p) {
+  return ((uint32_t) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static int be16(const uint8_t* p) {
+  return (p[0] << 8) | p[1];
+}
+
+static uint32_t le32(const uint8_t* p) {
+  return ((uint32_t) p[3] << 24) | (p[2] << 16) | (p[1] << 8) | p[0];
+}
+
+static int le16(const uint8_t* p) {
+  return (p[1] << 8) | p[0];
+}
+
+static void put_le32(uint8_t* p, uint32_t x) {
+  p[0] = x;
+  p[1] = x >> 8;
+  p[2] = x >> 16;
+  p[3] = x >> 24;
+}
+
+static void write_wav_header(FILE* f, int sr, long long frames) {
+  uint8_t h[44];
+  uint32_t size = frames * 2 * sizeof(float);
+  memcpy(h, "RIFF\0\0\0\0WAVEfmt \x10\0\0\0\x03\0\x02\0", 24);
+  put_le32(h + 4, 36 + size);
+  put_le32(h + 24, sr);
+  put_le32(h + 28, sr * 2 * sizeof(float));
+  memcpy(h + 32, "\x08\0\x20\0data", 8);
+  put_le32(h + 40, size);
+  fwrite(h, 1, sizeof(h), f);
+}
+
+/* Renders output samples up to the given position, stops at a failed write */
+static void render_until(struct render* r, long long position) {
+  size_t bytes;
+  int i, n;
+  if (r->recording) {
+    r->position = position > r->position ? position : r->position;
+    return;
+  }
+  while (r->position < position && !r->write_failed) {
+    n = position - r->position < BLOCK_SIZE ? position - r->position : BLOCK_SIZE;
+    if (r->position < r->start && r->start - r->position < n) {
+      n = r->start - r->position;
+    }
+    ayumi_process_block(&r->ay, r->left, r->right, n, r->opt->remove_dc);
+    if (r->position >= r->start) {
+      for (i = 0; i < n; i += 1) {
+        r->frames[i * 2] = r->left[i];
+        r->frames[i * 2 + 1] = r->right[i];
+      }
+      bytes = sizeof(float) * 2 * n;
+      if (r->segmented) {
+        r->write_failed = pwrite(fileno(r->out), r->frames, bytes, 44 * (r->opt->format == FORMAT_WAV)
+          + r->position * sizeof(float) * 2) != (ssize_t) bytes;
+      } else {
+        r->write_failed = fwrite(r->frames, sizeof(float) * 2, n, r->out) != (size_t) n;
+      }
+    }
+    r->position += n;
+  }
+}
+
+static void add_event(struct render* r, int reg, int value) {
+  struct event* e;
+  if (r->event_count == r->event_capacity) {
+    r->event_capacity = r->event_capacity ? r->event_capacity * 2 : 4096;
+    e = realloc(r->events, r->event_capacity * sizeof(struct event));
+    if (!e) {
+      r->out_of_memory = 1;
+      r->event_capacity = r->event_count;
+      return;
+    }
+    r->events = e;
+  }
+  e = &r->events[r->event_count];
+  e->position = r->position;
+  e->reg = reg;
+  e->value = value;
+  r->event_count += 1;
+}
+
+static void write_register(struct render* r, int reg, int value) {
+  struct ayumi* ay = &r->ay;
+  int* p = r->regs;
+  int i;
+  if (reg > 13) {
+    return;
+  }
+  if (r->recording) {
+    add_event(r, reg, value);
+    return;
+  }
+  p[reg] = value & 0xff;
+  switch (reg) {
+  case 0: case 1: case 2: case 3: case 4: case 5:
+    i = reg >> 1;
+    ayumi_set_tone(ay, i, ((p[i * 2 + 1] & 0xf) << 8) | p[i * 2]);
+    break;
+  case 6:
+    ayumi_set_noise(ay, p[6]);
+    break;
+  case 7: case 8: case 9: case 10:
+    for (i = 0; i < TONE_CHANNELS; i += 1) {
+      if (reg == 7 || reg == 8 + i) {
+        ayumi_set_mixer(ay, i, (p[7] >> i) & 1, (p[7] >> (i + 3)) & 1, (p[8 + i] >> 4) & 1);
+        ayumi_set_volume(ay, i, p[8 + i] & 0xf);
+      }
+    }
+    break;
+  case 11: case 12:
+    ayumi_set_envelope(ay, (p[12] << 8) | p[11]);
+    break;
+  case 13:
+    ayumi_set_envelope_shape(ay, p[13] & 0xf);
+    break;
+  }
+}
+
+static int configure(struct render* r, int is_ym, double clock_rate) {
+  int i;
+  if (!ayumi_configure(&r->ay, is_ym, clock_rate, r->opt->sample_rate)) {
+    return 0;
+  }
+  ayumi_set_quality(&r->ay, r->opt->quality);
+  ayumi_set_engine(&r->ay, r->opt->engine);
+  for (i = 0; i < TONE_CHANNELS; i += 1) {
+    ayumi_set_pan(&r->ay, i, r->opt->pan[i], r->opt->is_eqp);
+  }
+  r->is_ym = is_ym;
+  r->clock_rate = clock_rate;
+  return 1;
+}
+
+static const char* setup(struct render* r, int is_ym, double clock_rate) {
+  int i;
+  if (!configure(r, is_ym, clock_rate)) {
+    return "sample rate too low for the chip clock";
+  }
+  for (i = 0; i < 14; i += 1) {
+    write_register(r, i, i == 7 ? 0xff : 0);
+  }
+  return NULL;
+}
+
+/*
+ * Plays a frame dump of regs registers per frame, either frame by frame
+ * or register by register (interleaved). 255 in register 13 means that
+ * the envelope shape was not written in this frame.
+ */
+static void play_frames(struct render* r, const uint8_t* data, int frames, int regs,
+    int interleaved, int frame_rate) {
+  int f, i, value;
+  int last[14];
+  for (i = 0; i < 14; i += 1) {
+    last[i] = -1;
+  }
+  for (f = 0; f < frames; f += 1) {
+    for (i = 0; i < 14; i += 1) {
+      value = interleaved ? data[(size_t) i * frames + f] : data[(size_t) f * regs + i];
+      if (i == 13 ? value != 255 : value != last[i]) {
+        write_register(r, i, value);
+      }
+      last[i] = value;
+    }
+    render_until(r, (long long) (f + 1) * r->opt->sample_rate / frame_rate);
+  }
+}
+
+static const char* play_ym(struct render* r, const uint8_t* data, size_t size) {
+  const uint8_t* p;
+  const uint8_t* end = data + size;
+  const char* error;
+  int frames, attributes, drums, frame_rate, i;
+  if (size > 6 && !memcmp(data + 2, "-lh", 3)) {
+    return "LHA-compressed YM file, unpack it first";
+  }
+  if (!memcmp(data, "YM2!", 4) || !memcmp(data, "YM3!", 4) || !memcmp(data, "YM3b", 4)) {
+    frames = (size - (data[3] == 'b' ? 8 : 4)) / 14;
+    if ((error = setup(r, 1, 2000000))) {
+      return error;
+    }
+    play_frames(r, data + 4, frames, 14, 1, 50);
+    return NULL;
+  }
+  if (size < 34 || (memcmp(data, "YM5!", 4) && memcmp(data, "YM6!", 4))) {
+    return "unsupported YM version";
+  }
+  frames = be32(data + 12);
+  attributes = be32(data + 16);
+  drums = be16(data + 20);
+  frame_rate = be16(data + 26);
+  p = data + 34 + be16(data + 32);
+  for (i = 0; i < drums && p + 4 <= end; i += 1) {
+    p += 4 + be32(p);
+  }
+  for (i = 0; i < 3 && p < end; i += 1) {
+    p += strnlen((const char*) p, end - p) + 1;
+  }
+  if (p > end || (size_t) (end - p) < (size_t) frames * 16 || frame_rate <= 0) {
+    return "truncated YM file";
+  }
+  if ((error = setup(r, 1, be32(data + 22)))) {
+    return error;
+  }
+  play_frames(r, p, frames, 16, attributes & 1, frame_rate);
+  return NULL;
+}
+
+/* ZX Spectrum PSG: register writes separated by 1/50 s frame markers */
+static const char* play_psg(struct render* r, const uint8_t* data, size_t size) {
+  const uint8_t* p = data + 16;
+  const uint8_t* end = data + size;
+  const char* error;
+  long long frame = 0;
+  if ((error = setup(r, 0, 1773400))) {
+    return error;
+  }
+  while (p < end) {
+    if (*p == 0xff) {
+      frame += 1;
+      p += 1;
+    } else if (*p == 0xfe && p + 1 < end) {
+      frame += p[1] * 4;
+      p += 2;
+    } else if (*p == 0xfd) {
+      break;
+    } else if (p + 1 < end) {
+      render_until(r, frame * r->opt->sample_rate / 50);
+      write_register(r, p[0] & 0xf, p[1]);
+      p += 2;
+    } else {
+      break;
+    }
+  }
+  render_until(r, frame * r->opt->sample_rate / 50);
+  return NULL;
+}
+
+/* Length of a VGM command, 0 for the end of data or an unknown command */
+static size_t vgm_command_size(const uint8_t* p, const uint8_t* end) {
+  int c = *p;
+  if (c == 0x66) {
+    return 0;
+  }
+  if (c == 0x67) {
+    return p + 7 <= end ? 7 + (le32(p + 3) & 0x7fffffff) : 0;
+  }
+  if ((c >= 0x30 && c <= 0x3f) || c == 0x4f || c == 0x50 || c == 0x94) {
+    return 2;
+  }
+  if ((c >= 0x40 && c <= 0x4e) || (c >= 0x51 && c <= 0x5f) || c == 0x61
+    || (c >= 0xa0 && c <= 0xbf)) {
+    return 3;
+  }
+  if (c == 0x62 || c == 0x63 || (c >= 0x70 && c <= 0x8f)) {
+    return 1;
+  }
+  if (c >= 0xc0 && c <= 0xdf) {
+    return 4;
+  }
+  if (c >= 0xe0 || c == 0x90 || c == 0x91 || c == 0x95) {
+    return 5;
+  }
+  if (c == 0x92) {
+    return 6;
+  }
+  if (c == 0x93) {
+    return 11;
+  }
+  if (c == 0x68) {
+    return 12;
+  }
+  return 0;
+}
+
+static const char* play_vgm(struct render* r, const uint8_t* data, size_t size) {
+  const uint8_t* p;
+  const uint8_t* end = data + size;
+  const char* error;
+  uint32_t version, offset, clock_rate;
+  long long samples = 0;
+  size_t n;
+  int type;
+  version = size >= 0x40 ? le32(data + 8) : 0;
+  if (version < 0x151 || size < 0x7c || !(clock_rate = le32(data + 0x74) & 0x3fffffff)) {
+    return "no AY-3-8910 in VGM file";
+  }
+  type = data[0x78];
+  if (data[0x79] & 0x10) {
+    clock_rate /= 2; /* YM2149 with the clock divider pin low */
+  }
+  offset = le32(data + 0x34);
+  p = data + (offset ? 0x34 + offset : 0x40);
+  if ((error = setup(r, type >= 0x10, clock_rate))) {
+    return error;
+  }
+  while (p < end && (n = vgm_command_size(p, end)) && p + n <= end) {
+    switch (*p) {
+    case 0x61:
+      samples += le16(p + 1);
+      break;
+    case 0x62:
+      samples += 735;
+      break;
+    case 0x63:
+      samples += 882;
+      break;
+    case 0xa0:
+      if (!(p[1] & 0x80)) { /* the second chip is not rendered */
+        render_until(r, samples * r->opt->sample_rate / VGM_RATE);
+        write_register(r, p[1] & 0xf, p[2]);
+      }
+      break;
+    default:
+      if (*p >= 0x70 && *p <= 0x7f) {
+        samples += (*p & 0xf) + 1;
+      } else if (*p >= 0x80 && *p <= 0x8f) {
+        samples += *p & 0xf;
+      }
+      break;
+    }
+    p += n;
+  }
+  render_until(r, samples * r->opt->sample_rate / VGM_RATE);
+  return NULL;
+}
+
+static const char* play(struct render* r, const uint8_t* data, size_t size) {
+  if (size >= 4 && !memcmp(data, "Vgm ", 4)) {
+    return play_vgm(r, data, size);
+  }
+  if (size >= 16 && !memcmp(data, "PSG\x1a", 4)) {
+    return play_psg(r, data, size);
+  }
+  if (size >= 4 && (!memcmp(data, "YM", 2) || (size > 6 && !memcmp(data + 2, "-lh", 3)))) {
+    return play_ym(r, data, size);
+  }
+  if (size >= 2 && data[0] == 0x1f && data[1] == 0x8b) {
+    return "gzip-compressed file, unpack it first";
+  }
+  return "unknown file format";
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void* map_input(struct job* job, size_t* size) {
+  struct stat st;
+  void* data;
+  int fd = open(job->input, O_RDONLY);
+  if (fd < 0 || fstat(fd, &st) || st.st_size == 0) {
+    job->error = "cannot read file";
+    if (fd >= 0) {
+      close(fd);
+    }
+    return NULL;
+  }
+  data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    job->error = "cannot map file";
+    return NULL;
+  }
+  madvise(data, st.st_size, MADV_SEQUENTIAL);
+  *size = st.st_size;
+  return data;
+}
+
+static struct render* new_render(void) {
+  struct render* r = aligned_alloc(64, sizeof(struct render));
+  if (r) {
+    memset(r, 0, sizeof(struct render));
+    r->opt = &options;
+  }
+  return r;
+}
+
+static void render_job(struct job* job) {
+  struct render* r;
+  size_t size;
+  double start = now();
+  void* data = map_input(job, &size);
+  if (!data) {
+    return;
+  }
+  r = new_render();
+  if (!r || !(r->out = fopen(job->output, "wb"))) {
+    job->error = "cannot create output file";
+  } else {
+    if (options.format == FORMAT_WAV) {
+      write_wav_header(r->out, options.sample_rate, 0);
+    }
+    job->error = play(r, data, size);
+    if (options.format == FORMAT_WAV) {
+      fseek(r->out, 0, SEEK_SET);
+      write_wav_header(r->out, options.sample_rate, r->position);
+    }
+    if ((fclose(r->out) || r->write_failed) && !job->error) {
+      job->error = "cannot write output file";
+    }
+    if (job->error) {
+      unlink(job->output);
+    }
+  }
+  job->seconds = r ? (double) r->position / options.sample_rate : 0;
+  job->elapsed = now() - start;
+  free(r);
+  munmap(data, size);
+}
+
+/*
+ * The segments of a file, taken by the threads in order. The checkpoints
+ * are taken while the segments render, segment n waits for checkpoint
+ * n - 1 only.
+ */
+struct segments {
+  const struct render* pass;
+  FILE* out;
+  long long frames; /* per segment */
+  int count;
+  struct checkpoint* checkpoints;
+  int ready; /* checkpoints taken, under lock */
+  pthread_mutex_t lock;
+  pthread_cond_t taken;
+  atomic_int next;
+  atomic_int failed;
+  atomic_int write_failed;
+};
+
+/* Ticks the chip without filtering up to the given position, taking the checkpoints on the way */
+static void advance_until(struct render* r, struct segments* s, long long position, size_t event) {
+  struct checkpoint* c;
+  long long next, n;
+  for (;;) {
+    next = s->ready + 1 < s->count ? (s->ready + 1) * s->frames - SEGMENT_WARMUP : -1;
+    if (r->position == next) {
+      c = &s->checkpoints[s->ready];
+      c->position = r->position;
+      c->event = event;
+      memcpy(c->regs, r->regs, sizeof(c->regs));
+      ayumi_save_state(&r->ay, &c->state);
+      pthread_mutex_lock(&s->lock);
+      s->ready += 1;
+      pthread_cond_broadcast(&s->taken);
+      pthread_mutex_unlock(&s->lock);
+      continue;
+    }
+    if (r->position >= position) {
+      return;
+    }
+    n = position - r->position;
+    if (next > r->position && next - r->position < n) {
+      n = next - r->position;
+    }
+    n = n < BLOCK_SIZE ? n : BLOCK_SIZE;
+    ayumi_advance(&r->ay, (int) n);
+    r->position += n;
+  }
+}
+
+/* Replays the writes of the parse pass with the chip alone, a fraction of the cost of rendering */
+static void take_checkpoints(struct render* r, struct segments* s) {
+  const struct render* pass = s->pass;
+  size_t e;
+  configure(r, pass->is_ym, pass->clock_rate);
+  for (e = 0; e < pass->event_count; e += 1) {
+    advance_until(r, s, pass->events[e].position, e);
+    write_register(r, pass->events[e].reg, pass->events[e].value);
+  }
+  advance_until(r, s, pass->position, e);
+}
+
+/*
+ * Renders a segment from its checkpoint and replays the writes of the
+ * parse pass from there. The first one starts from the beginning, like a
+ * serial render, the others warm the filters up first. Returns 0 when
+ * the output could not be written.
+ */
+static int render_segment(struct render* r, struct segments* s, int index) {
+  const struct render* pass = s->pass;
+  const struct checkpoint* c = index > 0 ? &s->checkpoints[index - 1] : NULL;
+  long long end = index + 1 < s->count ? (index + 1) * s->frames : pass->position;
+  size_t e = 0;
+  pthread_mutex_lock(&s->lock);
+  while (s->ready < index) {
+    pthread_cond_wait(&s->taken, &s->lock);
+  }
+  pthread_mutex_unlock(&s->lock);
+  configure(r, pass->is_ym, pass->clock_rate);
+  memset(r->regs, 0, sizeof(r->regs));
+  r->position = 0;
+  r->start = index * s->frames;
+  if (c) {
+    ayumi_load_state(&r->ay, &c->state);
+    memcpy(r->regs, c->regs, sizeof(r->regs));
+    r->position = c->position;
+    e = c->event;
+  }
+  r->write_failed = 0;
+  for (; e < pass->event_count && pass->events[e].position < end && !r->write_failed; e += 1) {
+    render_until(r, pass->events[e].position);
+    write_register(r, pass->events[e].reg, pass->events[e].value);
+  }
+  render_until(r, end);
+  return !r->write_failed;
+}
+
+static void* segment_worker(void* arg) {
+  struct segments* s = arg;
+  struct render* r = new_render();
+  int index;
+  if (!r) {
+    atomic_store(&s->failed, 1);
+    return NULL;
+  }
+  r->out = s->out;
+  r->segmented = 1;
+  while ((index = atomic_fetch_add(&s->next, 1)) < s->count) {
+    if (!render_segment(r, s, index)) {
+      atomic_store(&s->write_failed, 1);
+    }
+  }
+  free(r);
+  return NULL;
+}
+
+/*
+ * One file on every thread: a parse pass collects the register writes,
+ * then this thread replays them with the chip alone and takes a
+ * checkpoint before each segment, while the other threads render the
+ * segments from there straight to their place in the file.
+ */
+static void render_job_segmented(struct job* job, int thread_count) {
+  pthread_t threads[64];
+  struct segments s;
+  struct render* pass;
+  struct render* ticker = NULL;
+  size_t size;
+  int i;
+  double start = now();
+  void* data = map_input(job, &size);
+  if (!data) {
+    return;
+  }
+  memset(&s, 0, sizeof(s));
+  pass = new_render();
+  if (!pass) {
+    job->error = "out of memory";
+    munmap(data, size);
+    return;
+  }
+  pass->recording = 1;
+  job->error = play(pass, data, size);
+  munmap(data, size);
+  s.pass = pass;
+  s.frames = (long long) (options.segment * options.sample_rate);
+  s.frames = s.frames < SEGMENT_WARMUP * 2 ? SEGMENT_WARMUP * 2 : s.frames;
+  s.count = (pass->position + s.frames - 1) / s.frames;
+  s.count = s.count < 1 ? 1 : s.count;
+  if (!job->error && (pass->out_of_memory || !(ticker = new_render())
+      || !(s.checkpoints = malloc(s.count * sizeof(struct checkpoint))))) {
+    job->error = "out of memory";
+  }
+  if (!job->error && !(s.out = fopen(job->output, "wb"))) {
+    job->error = "cannot create output file";
+  }
+  if (!job->error) {
+    pthread_mutex_init(&s.lock, NULL);
+    pthread_cond_init(&s.taken, NULL);
+    atomic_init(&s.next, 0);
+    atomic_init(&s.failed, 0);
+    atomic_init(&s.write_failed, 0);
+    if (options.format == FORMAT_WAV) {
+      write_wav_header(s.out, options.sample_rate, pass->position);
+    }
+    fflush(s.out);
+    thread_count = thread_count > s.count ? s.count : thread_count;
+    for (i = 1; i < thread_count; i += 1) {
+      if (pthread_create(&threads[i], NULL, segment_worker, &s)) {
+        break;
+      }
+    }
+    thread_count = i;
+    take_checkpoints(ticker, &s);
+    segment_worker(&s);
+    for (i = 1; i < thread_count; i += 1) {
+      pthread_join(threads[i], NULL);
+    }
+    pthread_cond_destroy(&s.taken);
+    pthread_mutex_destroy(&s.lock);
+    if (fclose(s.out) || atomic_load(&s.write_failed)) {
+      job->error = "cannot write output file";
+    }
+    if (atomic_load(&s.failed)) {
+      job->error = "out of memory";
+    }
+    if (job->error) {
+      unlink(job->output);
+    }
+  }
+  job->seconds = (double) pass->position / options.sample_rate;
+  job->elapsed = now() - start;
+  free(s.checkpoints);
+  free(ticker);
+  free(pass->events);
+  free(pass);
+}
+
+static void* worker(void* arg) {
+  int index;
+  (void) arg;
+  while ((index = atomic_fetch_add(&next_job, 1)) < job_count) {
+    render_job(&jobs[index]);
+  }
+  return NULL;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr,
+    "Usage: %s [options] file...\n"
+    "Renders YM (YM2!-YM6!), PSG and VGM register dumps to file.wav or file.raw\n"
+    "  -o file     output file, only with a single input\n"
+    "  -r rate     sample rate (44100)\n"
+    "  -f format   wav or raw, raw is interleaved stereo 32-bit float\n"
+    "  -s stereo   abc, acb or mono (abc)\n"
+    "  -e          equal power panning\n"
+    "  -q quality  draft, standard or high (standard)\n"
+    "  -m engine   fir or blep (fir)\n"
+    "  -n          keep the DC offset\n"
+    "  -j jobs     files rendered in parallel (all cores)\n"
+    "  -p seconds  render each file in segments of this length, in parallel\n", name);
+}
+
+int main(int argc, char** argv) {
+  pthread_t threads[64];
+  int thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+  int opt, i, failed = 0;
+  size_t len;
+  while ((opt = getopt(argc, argv, "o:r:f:s:eq:m:nj:p:")) != -1) {
+    switch (opt) {
+    case 'o':
+      options.output = optarg;
+      break;
+    case 'r':
+      options.sample_rate = atoi(optarg);
+      break;
+    case 'f':
+      options.format = !strcmp(optarg, "raw") ? FORMAT_RAW : FORMAT_WAV;
+      break;
+    case 's':
+      if (!strcmp(optarg, "acb")) {
+        options.pan[1] = 0.9;
+        options.pan[2] = 0.5;
+      } else if (!strcmp(optarg, "mono")) {
+        options.pan[0] = options.pan[1] = options.pan[2] = 0.5;
+      }
+      break;
+    case 'e':
+      options.is_eqp = 1;
+      break;
+    case 'q':
+      options.quality = !strcmp(optarg, "draft") ? AYUMI_QUALITY_DRAFT
+        : !strcmp(optarg, "high") ? AYUMI_QUALITY_HIGH : AYUMI_QUALITY_STANDARD;
+      break;
+    case 'm':
+      options.engine = !strcmp(optarg, "blep") ? AYUMI_ENGINE_BLEP : AYUMI_ENGINE_FIR;
+      break;
+    case 'n':
+      options.remove_dc = 0;
+      break;
+    case 'j':
+      thread_count = atoi(optarg);
+      break;
+    case 'p':
+      options.segment = atof(optarg);
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  job_count = argc - optind;
+  if (job_count < 1 || options.sample_rate <= 0 || (options.output && job_count > 1)) {
+    usage(argv[0]);
+    return 1;
+  }
+  jobs = calloc(job_count, sizeof(struct job));
+  for (i = 0; i < job_count; i += 1) {
+    jobs[i].input = argv[optind + i];
+    if (options.output) {
+      jobs[i].output = strdup(options.output);
+    } else {
+      len = strlen(jobs[i].input);
+      jobs[i].output = malloc(len + 5);
+      sprintf(jobs[i].output, "%s.%s", jobs[i].input, options.format == FORMAT_RAW ? "raw" : "wav");
+    }
+  }
+  thread_count = thread_count < 1 ? 1 : thread_count;
+  thread_count = thread_count > 64 ? 64 : thread_count;
+  if (options.segment > 0) {
+    for (i = 0; i < job_count; i += 1) {
+      render_job_segmented(&jobs[i], thread_count);
+    }
+  } else {
+    thread_count = thread_count > job_count ? job_count : thread_count;
+    for (i = 1; i < thread_count; i += 1) {
+      if (pthread_create(&threads[i], NULL, worker, NULL)) {
+        break;
+      }
+    }
+    thread_count = i;
+    worker(NULL);
+    for (i = 1; i < thread_count; i += 1) {
+      pthread_join(threads[i], NULL);
+    }
+  }
+  for (i = 0; i < job_count; i += 1) {
+    if (jobs[i].error) {
+      fprintf(stderr, "%s: %s\n", jobs[i].input, jobs[i].error);
+      failed = 1;
+    } else {
+      printf("%s: %.1f s in %.3f s, %.1fx realtime\n", jobs[i].output, jobs[i].seconds,
+        jobs[i].elapsed, jobs[i].seconds / (jobs[i].elapsed > 0 ? jobs[i].elapsed : 1e-9));
+    }
+    free(jobs[i].output);
+  }
+  free(jobs);
+  return failed;
+}
@@ -0,0 +1,348 @@
+/* Replays register traces recorded by the plugin through the ayumi core */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <time.h>
+#include <getopt.h>
+#include "ayumi.h"
+#include "ayumi_trace.h"
+#include "ayumi_upsample.h"
+
+enum {
+  BLOCK_SIZE = 256,
+  MAX_CHIPS = AYUMI_TRACE_ALL_CHIPS
+};
+
+enum {
+  FORMAT_WAV,
+  FORMAT_RAW,
+  FORMAT_NONE
+};
+
+struct replay {
+  int sample_rate;
+  int flags;
+  int factor; /* host frames per rendered frame */
+  struct ayumi_upsampler upsampler;
+  int chip_count;
+  struct ayumi* chips[MAX_CHIPS];
+  struct ayumi_stems* stems[MAX_CHIPS];
+  FILE* out;
+  uint64_t position;
+  uint64_t lost;
+  double elapsed; /* seconds spent in the core */
+  float left[BLOCK_SIZE];
+  float right[BLOCK_SIZE];
+  float sum[2][BLOCK_SIZE];
+  float upsampled[2][BLOCK_SIZE];
+  float mix[BLOCK_SIZE * 2];
+  float last[2]; /* last frame, what the upsampler starts from */
+  int32_t restored[MAX_CHIPS][AYUMI_TRACE_STATE_WORDS]; /* state records so far */
+};
+
+static const char* op_names[AYUMI_TRACE_OP_COUNT] = {
+  "configure", "reconfigure", "quality", "engine", "pan", "tone", "noise", "mixer",
+  "volume", "envelope", "envelope_shape", "remove_dc", "chips", "stop", "dropped", "restore",
+  "upsample", "state"
+};
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void put_le32(uint8_t* p, uint32_t x) {
+  p[0] = x;
+  p[1] = x >> 8;
+  p[2] = x >> 16;
+  p[3] = x >> 24;
+}
+
+static void write_wav_header(FILE* f, int sr, long long frames) {
+  uint8_t h[44];
+  uint32_t size = frames * 2 * sizeof(float);
+  memcpy(h, "RIFF\0\0\0\0WAVEfmt \x10\0\0\0\x03\0\x02\0", 24);
+  put_le32(h + 4, 36 + size);
+  put_le32(h + 24, sr);
+  put_le32(h + 28, sr * 2 * sizeof(float));
+  memcpy(h + 32, "\x08\0\x20\0data", 8);
+  put_le32(h + 40, size);
+  fwrite(h, 1, sizeof(h), f);
+}
+
+/* Mixes count frames of the chips the way the plugin does, in chip order */
+static void mix_chips(struct replay* r, int count) {
+  float* none[TONE_CHANNELS] = {NULL, NULL, NULL};
+  int c, i;
+  double start;
+  memset(r->sum, 0, sizeof(r->sum));
+  for (c = 0; c < r->chip_count; c += 1) {
+    if (!r->chips[c]) {
+      continue;
+    }
+    start = now();
+    if (r->stems[c]) {
+      ayumi_process_stems(r->chips[c], r->stems[c], none, r->left, r->right, count, 1);
+    } else {
+      ayumi_process_block(r->chips[c], r->left, r->right, count, 1);
+    }
+    r->elapsed += now() - start;
+    for (i = 0; i < count; i += 1) {
+      r->sum[0][i] += r->left[i];
+      r->sum[1][i] += r->right[i];
+    }
+  }
+}
+
+/*
+ * Renders up to the given frame. At a capped render rate each block of
+ * host frames renders what the upsampler needs for it, like the plugin.
+ */
+static void render_until(struct replay* r, uint64_t frame) {
+  float* in[2] = {r->sum[0], r->sum[1]};
+  float* up[2] = {r->upsampled[0], r->upsampled[1]};
+  float* const* out = in;
+  int i, n, needed;
+  while (r->position < frame) {
+    n = frame - r->position < BLOCK_SIZE ? (int) (frame - r->position) : BLOCK_SIZE;
+    if (r->factor > 1) {
+      needed = ayumi_upsample_needed(&r->upsampler, n);
+      if (needed > 0) {
+        mix_chips(r, needed);
+      }
+      ayumi_upsample_process(&r->upsampler, in, up, n);
+      out = up;
+    } else {
+      mix_chips(r, n);
+    }
+    for (i = 0; i < n; i += 1) {
+      r->mix[i * 2] = out[0][i];
+      r->mix[i * 2 + 1] = out[1][i];
+    }
+    r->last[0] = out[0][n - 1];
+    r->last[1] = out[1][n - 1];
+    if (r->out) {
+      fwrite(r->mix, sizeof(float) * 2, n, r->out);
+    }
+    r->position += n;
+  }
+}
+
+static const char* add_chip(struct replay* r, int c) {
+  if (r->chips[c]) {
+    return NULL;
+  }
+  r->chips[c] = aligned_alloc(64, sizeof(struct ayumi));
+  if (!r->chips[c]) {
+    return "out of memory";
+  }
+  memset(r->chips[c], 0, sizeof(struct ayumi));
+  return NULL;
+}
+
+/* Chips are configured by the trace, stems once they are */
+static const char* apply(struct replay* r, const struct ayumi_trace_record* rec) {
+  int first = rec->chip == AYUMI_TRACE_ALL_CHIPS ? 0 : rec->chip;
+  int last = rec->chip == AYUMI_TRACE_ALL_CHIPS ? MAX_CHIPS : rec->chip + 1;
+  int c;
+  const char* error;
+  struct ayumi_state state;
+  switch (rec->op) {
+  case AYUMI_TRACE_CHIPS:
+    r->chip_count = rec->value.i < 0 ? 0 : rec->value.i > MAX_CHIPS ? MAX_CHIPS : rec->value.i;
+    return NULL;
+  case AYUMI_TRACE_DROPPED:
+    if (!r->lost) {
+      fprintf(stderr, "%" PRIu64 " records lost from frame %" PRIu64 ", the replay is not exact from there\n",
+        (uint64_t) rec->value.i, rec->frame);
+    }
+    r->lost += rec->value.i;
+    return NULL;
+  case AYUMI_TRACE_STATE:
+    if (rec->chip != AYUMI_TRACE_ALL_CHIPS && rec->channel < AYUMI_TRACE_STATE_WORDS) {
+      r->restored[rec->chip][rec->channel] = rec->value.i;
+    }
+    return NULL;
+  case AYUMI_TRACE_RESTORE:
+    if (rec->chip == AYUMI_TRACE_ALL_CHIPS) {
+      /* older traces do not carry the restored registers, counted as one lost record */
+      if (!r->lost) {
+        fprintf(stderr, "state restored at frame %" PRIu64 ", the replay is not exact from there\n", rec->frame);
+      }
+      r->lost += 1;
+    } else if (r->chips[rec->chip]) {
+      ayumi_trace_unpack_state(&state, r->restored[rec->chip]);
+      ayumi_load_state(r->chips[rec->chip], &state);
+      if (r->stems[rec->chip]) {
+        ayumi_stems_settle(r->stems[rec->chip], r->chips[rec->chip]);
+      }
+    }
+    return NULL;
+  case AYUMI_TRACE_UPSAMPLE:
+    if (rec->value.i > 1 && !ayumi_upsample_configure(&r->upsampler, rec->value.i, 2)) {
+      return "bad upsampling factor";
+    }
+    r->factor = rec->value.i > 1 ? rec->value.i : 1;
+    ayumi_upsample_reset(&r->upsampler, r->last);
+    return NULL;
+  case AYUMI_TRACE_CONFIGURE:
+    if (rec->chip == AYUMI_TRACE_ALL_CHIPS) {
+      return "configure without a chip";
+    }
+    if ((error = add_chip(r, rec->chip))) {
+      return error;
+    }
+    break;
+  }
+  for (c = first; c < last; c += 1) {
+    if (r->chips[c]) {
+      ayumi_trace_apply(r->chips[c], rec, r->sample_rate / r->factor);
+    }
+  }
+  if (rec->op == AYUMI_TRACE_CONFIGURE && (r->flags & AYUMI_TRACE_STEMS) && !r->stems[first]) {
+    r->stems[first] = aligned_alloc(64, sizeof(struct ayumi_stems));
+    if (!r->stems[first]) {
+      return "out of memory";
+    }
+    ayumi_stems_configure(r->stems[first], r->chips[first]);
+  }
+  return NULL;
+}
+
+static void dump(const struct ayumi_trace_record* rec) {
+  const char* name = rec->op < AYUMI_TRACE_OP_COUNT ? op_names[rec->op] : "unknown";
+  printf("%12" PRIu64 " %-14s", rec->frame, name);
+  switch (rec->op) {
+  case AYUMI_TRACE_CHIPS: case AYUMI_TRACE_STOP: case AYUMI_TRACE_DROPPED: case AYUMI_TRACE_UPSAMPLE:
+    printf(" %d\n", rec->value.i);
+    return;
+  }
+  if (rec->chip == AYUMI_TRACE_ALL_CHIPS) {
+    printf(" chip *");
+  } else {
+    printf(" chip %d", rec->chip);
+  }
+  switch (rec->op) {
+  case AYUMI_TRACE_CONFIGURE: case AYUMI_TRACE_RECONFIGURE:
+    printf(" %s %.1f Hz\n", rec->flag ? "ym" : "ay", rec->value.f);
+    break;
+  case AYUMI_TRACE_PAN:
+    printf(" channel %d %g%s\n", rec->channel, rec->value.f, rec->flag ? " eqp" : "");
+    break;
+  case AYUMI_TRACE_TONE: case AYUMI_TRACE_MIXER: case AYUMI_TRACE_VOLUME:
+    printf(" channel %d %d\n", rec->channel, rec->value.i);
+    break;
+  case AYUMI_TRACE_STATE:
+    printf(" word %d %d\n", rec->channel, rec->value.i);
+    break;
+  case AYUMI_TRACE_RESTORE:
+    printf("\n");
+    break;
+  default:
+    printf(" %d\n", rec->value.i);
+    break;
+  }
+}
+
+static void usage(const char* name) {
+  fprintf(stderr,
+    "Usage: %s [options] file\n"
+    "Renders an ayumi-lv2 register trace to file.wav or file.raw\n"
+    "  -o file     output file\n"
+    "  -f format   wav, raw or none, raw is interleaved stereo 32-bit float\n"
+    "  -d          print the records instead of rendering\n", name);
+}
+
+int main(int argc, char** argv) {
+  static struct replay r;
+  struct ayumi_trace_record rec;
+  const char* output = NULL;
+  const char* error = NULL;
+  char* path = NULL;
+  int format = FORMAT_WAV;
+  int print = 0;
+  int opt, c;
+  FILE* in;
+  double start, seconds;
+  while ((opt = getopt(argc, argv, "o:f:d")) != -1) {
+    switch (opt) {
+    case 'o':
+      output = optarg;
+      break;
+    case 'f':
+      format = !strcmp(optarg, "raw") ? FORMAT_RAW : !strcmp(optarg, "none") ? FORMAT_NONE : FORMAT_WAV;
+      break;
+    case 'd':
+      print = 1;
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (optind != argc - 1) {
+    usage(argv[0]);
+    return 1;
+  }
+  in = fopen(argv[optind], "rb");
+  if (!in || ayumi_trace_read_header(in, &r.sample_rate, &r.flags) || r.sample_rate <= 0) {
+    fprintf(stderr, "%s: not an ayumi trace\n", argv[optind]);
+    return 1;
+  }
+  r.factor = 1;
+  if (print) {
+    printf("%d Hz%s\n", r.sample_rate, r.flags & AYUMI_TRACE_STEMS ? ", stems" : "");
+    while (ayumi_trace_read(in, &rec)) {
+      dump(&rec);
+    }
+    fclose(in);
+    return 0;
+  }
+  if (format != FORMAT_NONE) {
+    if (!output) {
+      path = malloc(strlen(argv[optind]) + 5);
+      sprintf(path, "%s.%s", argv[optind], format == FORMAT_RAW ? "raw" : "wav");
+      output = path;
+    }
+    if (!(r.out = fopen(output, "wb"))) {
+      fprintf(stderr, "%s: cannot create output file\n", output);
+      return 1;
+    }
+    if (format == FORMAT_WAV) {
+      write_wav_header(r.out, r.sample_rate, 0);
+    }
+  }
+  start = now();
+  while (!error && ayumi_trace_read(in, &rec)) {
+    render_until(&r, rec.frame);
+    error = apply(&r, &rec);
+  }
+  seconds = now() - start;
+  fclose(in);
+  if (r.out) {
+    if (format == FORMAT_WAV) {
+      fseek(r.out, 0, SEEK_SET);
+      write_wav_header(r.out, r.sample_rate, r.position);
+    }
+    fclose(r.out);
+  }
+  for (c = 0; c < MAX_CHIPS; c += 1) {
+    free(r.chips[c]);
+    free(r.stems[c]);
+  }
+  if (error) {
+    fprintf(stderr, "%s: %s\n", argv[optind], error);
+    free(path);
+    return 1;
+  }
+  printf("%s: %.1f s in %.3f s, %.1fx realtime, %.1f ns/frame in the core\n",
+    output ? output : argv[optind], (double) r.position / r.sample_rate, seconds,
+    r.position / (double) r.sample_rate / (seconds > 0 ? seconds : 1e-9),
+    r.position ? r.elapsed * 1e9 / r.position : 0);
+  free(path);
+  return r.lost ? 2 : 0;
+}
@@ -0,0 +1,674 @@
+/* Real-time safety and latency check of the plugin, the gate before deploying a build */
+
+#define _GNU_SOURCE /* RTLD_NEXT and dladdr */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <dlfcn.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <lv2/core/lv2.h>
+#include <lv2/atom/atom.h>
+#include <lv2/urid/urid.h>
+#include <lv2/midi/midi.h>
+#include "ayumi.h"
+
+enum {
+  MAX_BLOCK = 8192,
+  MAX_EVENTS = 4096,
+  MAX_INSTANCES = 16,
+  MAX_URIS = 64,
+  PORT_COUNT = 34,
+  REGISTER_PORTS = 18, /* 15 in the stereo plugin */
+  REGISTER_PORT_COUNT = 15,
+  RENDER_RATE_PORT = 33, /* 30 in the stereo plugin */
+  TAIL_BLOCK = 256
+};
+
+/*
+ * Calls that must not happen while run() executes. Allocations are caught
+ * on every thread, so the chip workers count too; locks and waits only on
+ * the thread that calls run(), since idle workers wait on a semaphore.
+ */
+enum {
+  CALL_MALLOC,
+  CALL_CALLOC,
+  CALL_REALLOC,
+  CALL_FREE,
+  CALL_ALIGNED_ALLOC,
+  CALL_POSIX_MEMALIGN,
+  CALL_MUTEX_LOCK,
+  CALL_RWLOCK_RDLOCK,
+  CALL_RWLOCK_WRLOCK,
+  CALL_COND_WAIT,
+  CALL_COND_TIMEDWAIT,
+  CALL_SEM_WAIT,
+  CALL_SEM_TIMEDWAIT,
+  CALL_COUNT
+};
+
+static const char* call_names[CALL_COUNT] = {
+  "malloc", "calloc", "realloc", "free", "aligned_alloc", "posix_memalign",
+  "pthread_mutex_lock", "pthread_rwlock_rdlock", "pthread_rwlock_wrlock",
+  "pthread_cond_wait", "pthread_cond_timedwait", "sem_wait", "sem_timedwait"
+};
+
+static const int block_sizes[] = {1, 16, 64, 256, 1024, 4096, 8192};
+static const int event_spacings[] = {0, 256, 16, 1}; /* frames between events, 0 for none */
+static const char* density_names[] = {"none", "sparse", "dense", "flood"};
+static const int instance_counts[] = {1, 4, MAX_INSTANCES};
+
+struct options {
+  const LV2_Descriptor* plugin;
+  int sample_rate;
+  double seconds;
+  double tail;
+  double budget; /* worst run as a fraction of the block, 0 for no limit */
+  float chips;
+  float quality;
+  float engine;
+  float render_rate;
+};
+
+static atomic_int running;
+static __thread int run_thread;
+static atomic_int violations[CALL_COUNT];
+static atomic_uintptr_t callers[CALL_COUNT];
+
+static uint64_t sequence[(sizeof(LV2_Atom_Sequence) + MAX_EVENTS * (sizeof(LV2_Atom_Event) + 8)) / 8];
+static float outputs[5][MAX_BLOCK];
+static float controls[PORT_COUNT];
+static char* uris[MAX_URIS];
+static int uri_count;
+static uint32_t seed = 1;
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* p, size_t size);
+void __libc_free(void* p);
+void* __libc_memalign(size_t alignment, size_t size);
+
+static void violation(int call, void* caller) {
+  uintptr_t none = 0;
+  atomic_fetch_add(&violations[call], 1);
+  atomic_compare_exchange_strong(&callers[call], &none, (uintptr_t) caller);
+}
+
+#define CHECK_ALLOCATION(call) \
+  if (atomic_load_explicit(&running, memory_order_relaxed)) { \
+    violation(call, __builtin_return_address(0)); \
+  }
+
+#define CHECK_LOCK(call) \
+  if (run_thread) { \
+    violation(call, __builtin_return_address(0)); \
+  }
+
+/* The next definition of a function, for the interposed locks */
+#define REAL(name) \
+  static __typeof__(name)* real; \
+  if (!real) { \
+    real = (__typeof__(name)*) dlsym(RTLD_NEXT, #name); \
+  }
+
+void* malloc(size_t size) {
+  CHECK_ALLOCATION(CALL_MALLOC);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  CHECK_ALLOCATION(CALL_CALLOC);
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* p, size_t size) {
+  CHECK_ALLOCATION(CALL_REALLOC);
+  return __libc_realloc(p, size);
+}
+
+void free(void* p) {
+  CHECK_ALLOCATION(CALL_FREE);
+  __libc_free(p);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+  CHECK_ALLOCATION(CALL_ALIGNED_ALLOC);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** p, size_t alignment, size_t size) {
+  CHECK_ALLOCATION(CALL_POSIX_MEMALIGN);
+  *p = __libc_memalign(alignment, size);
+  return *p || !size ? 0 : ENOMEM;
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) {
+  REAL(pthread_mutex_lock);
+  CHECK_LOCK(CALL_MUTEX_LOCK);
+  return real(mutex);
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t* lock) {
+  REAL(pthread_rwlock_rdlock);
+  CHECK_LOCK(CALL_RWLOCK_RDLOCK);
+  return real(lock);
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t* lock) {
+  REAL(pthread_rwlock_wrlock);
+  CHECK_LOCK(CALL_RWLOCK_WRLOCK);
+  return real(lock);
+}
+
+int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex) {
+  REAL(pthread_cond_wait);
+  CHECK_LOCK(CALL_COND_WAIT);
+  return real(cond, mutex);
+}
+
+int pthread_cond_timedwait(pthread_cond_t* cond, pthread_mutex_t* mutex, const struct timespec* t) {
+  REAL(pthread_cond_timedwait);
+  CHECK_LOCK(CALL_COND_TIMEDWAIT);
+  return real(cond, mutex, t);
+}
+
+int sem_wait(sem_t* sem) {
+  REAL(sem_wait);
+  CHECK_LOCK(CALL_SEM_WAIT);
+  return real(sem);
+}
+
+int sem_timedwait(sem_t* sem, const struct timespec* t) {
+  REAL(sem_timedwait);
+  CHECK_LOCK(CALL_SEM_TIMEDWAIT);
+  return real(sem, t);
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int random_int(int n) {
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+static LV2_URID map_uri(LV2_URID_Map_Handle handle, const char* uri) {
+  int i;
+  (void) handle;
+  for (i = 0; i < uri_count; i += 1) {
+    if (!strcmp(uris[i], uri)) {
+      return i + 1;
+    }
+  }
+  if (uri_count == MAX_URIS) {
+    return 0;
+  }
+  uris[uri_count] = strdup(uri);
+  uri_count += 1;
+  return uri_count;
+}
+
+static void add_midi(LV2_Atom_Sequence* seq, LV2_URID midi, int frame, int b0, int b1, int b2) {
+  LV2_Atom_Event* ev = (LV2_Atom_Event*) ((uint8_t*) sequence + sizeof(LV2_Atom) + seq->atom.size);
+  uint8_t* msg = (uint8_t*) (ev + 1);
+  ev->time.frames = frame;
+  ev->body.type = midi;
+  ev->body.size = (b0 & 0xf0) == 0xc0 ? 2 : 3;
+  msg[0] = b0;
+  msg[1] = b1;
+  msg[2] = b2;
+  seq->atom.size += sizeof(LV2_Atom_Event) + 8;
+}
+
+/* Everything the MIDI mapping handles, and a channel it ignores */
+static void add_random_midi(LV2_Atom_Sequence* seq, LV2_URID midi, int frame) {
+  static const int controllers[] = {0x00, 0x07, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x50};
+  int channel = random_int(4);
+  switch (random_int(6)) {
+  case 0: case 1:
+    add_midi(seq, midi, frame, 0x90 | channel, 24 + random_int(84), 100);
+    break;
+  case 2:
+    add_midi(seq, midi, frame, 0x80 | channel, 24 + random_int(84), 0);
+    break;
+  case 3:
+    add_midi(seq, midi, frame, 0xb0 | channel, controllers[random_int(8)], random_int(128));
+    break;
+  case 4:
+    add_midi(seq, midi, frame, 0xc0 | channel, random_int(128), 0);
+    break;
+  default:
+    add_midi(seq, midi, frame, 0xe0 | channel, random_int(128), random_int(128));
+    break;
+  }
+}
+
+/* Automation: one of volume, pan, mixer, tone, noise, envelope and shape moves */
+static void move_register_port(void) {
+  static const int maxima[REGISTER_PORT_COUNT] = {
+    15, 15, 15, 128, 128, 128, 7, 7, 7, 4095, 4095, 4095, 31, 65535, 15
+  };
+  int i = random_int(REGISTER_PORT_COUNT);
+  controls[REGISTER_PORTS + i] = random_int(maxima[i] + 1);
+  if (i >= 3 && i < 6) {
+    controls[REGISTER_PORTS + i] /= 128; /* pan */
+  }
+}
+
+/*
+ * Events of the block starting at position, spacing frames apart in the
+ * stream, and a register port that moves with every block that has some.
+ */
+static void fill_sequence(LV2_Atom_Sequence* seq, LV2_URID midi, long long position, int block, int spacing) {
+  long long frame;
+  int count = 0;
+  seq->atom.size = sizeof(LV2_Atom_Sequence_Body);
+  if (!spacing) {
+    return;
+  }
+  move_register_port();
+  for (frame = (position + spacing - 1) / spacing * spacing; frame < position + block && count < MAX_EVENTS;
+    frame += spacing) {
+    add_random_midi(seq, midi, (int) (frame - position));
+    count += 1;
+  }
+}
+
+static LV2_Handle instantiate(const struct options* opt) {
+  static LV2_URID_Map map = {NULL, map_uri};
+  static LV2_Feature map_feature = {LV2_URID__map, &map};
+  static const LV2_Feature* features[] = {&map_feature, NULL};
+  const LV2_Descriptor* plugin = opt->plugin;
+  LV2_Handle handle = plugin->instantiate(plugin, opt->sample_rate, ".", features);
+  LV2_Atom_Sequence* seq = (LV2_Atom_Sequence*) sequence;
+  int i, stems;
+  if (!handle) {
+    return NULL;
+  }
+  seq->atom.type = map_uri(NULL, LV2_ATOM__Sequence);
+  seq->body.unit = 0;
+  seq->body.pad = 0;
+  controls[3] = opt->chips;
+  controls[4] = opt->quality;
+  controls[5] = 1;
+  controls[6] = 2000000;
+  controls[14] = opt->engine;
+  plugin->connect_port(handle, 0, seq);
+  plugin->connect_port(handle, 1, outputs[0]);
+  plugin->connect_port(handle, 2, outputs[1]);
+  for (i = 3; i < 15; i += 1) {
+    plugin->connect_port(handle, i, &controls[i]);
+  }
+  stems = !strcmp(plugin->URI + strlen(plugin->URI) - 6, "#stems");
+  if (stems) {
+    for (i = 15; i < 18; i += 1) {
+      plugin->connect_port(handle, i, outputs[i - 13]);
+    }
+  }
+  for (i = 0; i < REGISTER_PORT_COUNT; i += 1) {
+    controls[REGISTER_PORTS + i] = -1;
+    plugin->connect_port(handle, (stems ? REGISTER_PORTS : 15) + i, &controls[REGISTER_PORTS + i]);
+  }
+  controls[RENDER_RATE_PORT] = opt->render_rate;
+  plugin->connect_port(handle, stems ? RENDER_RATE_PORT : 30, &controls[RENDER_RATE_PORT]);
+  plugin->activate(handle);
+  return handle;
+}
+
+/* Times one run() with the checks armed */
+static double run(const LV2_Descriptor* plugin, LV2_Handle handle, int frames) {
+  double start;
+  run_thread = 1;
+  atomic_store(&running, 1);
+  start = now();
+  plugin->run(handle, frames);
+  start = now() - start;
+  atomic_store(&running, 0);
+  run_thread = 0;
+  return start;
+}
+
+static long count_subnormal_outputs(int frames) {
+  long count = 0;
+  int i, j;
+  for (i = 0; i < 5; i += 1) {
+    for (j = 0; j < frames; j += 1) {
+      count += fpclassify(outputs[i][j]) == FP_SUBNORMAL;
+    }
+  }
+  return count;
+}
+
+static int compare_times(const void* a, const void* b) {
+  double x = *(const double*) a;
+  double y = *(const double*) b;
+  return x < y ? -1 : x > y;
+}
+
+/* Returns 1 if the worst run is over the budget */
+static int measure(const struct options* opt, int block, int density, int instances, long* subnormals) {
+  LV2_Handle handles[MAX_INSTANCES];
+  LV2_Atom_Sequence* seq = (LV2_Atom_Sequence*) sequence;
+  LV2_URID midi = map_uri(NULL, LV2_MIDI__MidiEvent);
+  long long position;
+  long long frames = (long long) (opt->seconds * opt->sample_rate);
+  long runs = 0;
+  long count = (frames + block - 1) / block * instances;
+  double* times = malloc(count * sizeof(double));
+  double period = (double) block / opt->sample_rate;
+  double worst;
+  int i, over;
+  for (i = 0; i < instances; i += 1) {
+    handles[i] = instantiate(opt);
+  }
+  for (position = 0; position < frames; position += block) {
+    for (i = 0; i < instances; i += 1) {
+      fill_sequence(seq, midi, position, block, event_spacings[density]);
+      times[runs] = run(opt->plugin, handles[i], block);
+      runs += 1;
+      *subnormals += count_subnormal_outputs(block);
+    }
+  }
+  for (i = 0; i < instances; i += 1) {
+    opt->plugin->deactivate(handles[i]);
+    opt->plugin->cleanup(handles[i]);
+  }
+  qsort(times, runs, sizeof(double), compare_times);
+  worst = times[runs - 1];
+  over = opt->budget > 0 && worst > opt->budget * period;
+  printf("%5d %-6s %9d %8ld %8.1f %8.1f %8.1f %9.1f %7.1f%%%s\n", block, density_names[density],
+    instances, runs, times[runs / 2] * 1e6, times[(long) (runs * 0.99)] * 1e6,
+    times[(long) (runs * 0.999)] * 1e6, worst * 1e6, worst / period * 100, over ? "  OVER BUDGET" : "");
+  free(times);
+  return over;
+}
+
+/*
+ * Plays a second of events, releases every note and renders the tail.
+ * Returns the subnormal output samples, and the mean run time of the
+ * first and last second of the tail, which drifts apart if subnormals
+ * reach the filters.
+ */
+static long plugin_tail(const struct options* opt, double* first, double* last) {
+  LV2_Atom_Sequence* seq = (LV2_Atom_Sequence*) sequence;
+  LV2_URID midi = map_uri(NULL, LV2_MIDI__MidiEvent);
+  LV2_Handle handle = instantiate(opt);
+  long long position;
+  long long frames = (long long) (opt->tail * opt->sample_rate);
+  long long second = opt->sample_rate;
+  long subnormals = 0;
+  long first_runs = 0, last_runs = 0;
+  double t;
+  int channel, key;
+  *first = *last = 0;
+  for (position = 0; position < second; position += TAIL_BLOCK) {
+    fill_sequence(seq, midi, position, TAIL_BLOCK, 16);
+    run(opt->plugin, handle, TAIL_BLOCK);
+  }
+  seq->atom.size = sizeof(LV2_Atom_Sequence_Body);
+  for (channel = 0; channel < 3; channel += 1) {
+    for (key = 0; key < 128; key += 1) {
+      add_midi(seq, midi, 0, 0x80 | channel, key, 0);
+    }
+  }
+  for (position = 0; position < frames; position += TAIL_BLOCK) {
+    t = run(opt->plugin, handle, TAIL_BLOCK);
+    seq->atom.size = sizeof(LV2_Atom_Sequence_Body);
+    subnormals += count_subnormal_outputs(TAIL_BLOCK);
+    if (position < second) {
+      *first += t;
+      first_runs += 1;
+    }
+    if (position >= frames - second) {
+      *last += t;
+      last_runs += 1;
+    }
+  }
+  opt->plugin->deactivate(handle);
+  opt->plugin->cleanup(handle);
+  *first /= first_runs ? first_runs : 1;
+  *last /= last_runs ? last_runs : 1;
+  return subnormals;
+}
+
+#define COUNT_SUBNORMALS(count, array) \
+  for (i = 0; i < (int) (sizeof(array) / sizeof(*(array))); i += 1) { \
+    count += fpclassify((array)[i]) == FP_SUBNORMAL; \
+  }
+
+/* Integer samples cannot be subnormal */
+#ifdef AYUMI_SAMPLE_FIXED
+#define COUNT_SAMPLE_SUBNORMALS(count, array) (void) (array)
+#else
+#define COUNT_SAMPLE_SUBNORMALS(count, array) COUNT_SUBNORMALS(count, array)
+#endif
+
+/* Subnormal values in the filter state of a chip and its stems */
+static long scan_state(const struct ayumi* ay, const struct ayumi_stems* s) {
+  long count = 0;
+  int i, j;
+  double chip[] = {ay->mixer_left, ay->mixer_right, ay->left, ay->right, ay->dc_left.sum, ay->dc_right.sum};
+  ayumi_sample samples[] = {ay->blep_left, ay->blep_right};
+  COUNT_SUBNORMALS(count, chip);
+  COUNT_SAMPLE_SUBNORMALS(count, samples);
+  COUNT_SAMPLE_SUBNORMALS(count, ay->interpolator_left.c);
+  COUNT_SAMPLE_SUBNORMALS(count, ay->interpolator_left.y);
+  COUNT_SAMPLE_SUBNORMALS(count, ay->interpolator_right.c);
+  COUNT_SAMPLE_SUBNORMALS(count, ay->interpolator_right.y);
+  for (j = 0; j < AYUMI_FIR_MAX * 2; j += 1) {
+    COUNT_SAMPLE_SUBNORMALS(count, ay->fir[j]);
+  }
+#ifdef AYUMI_COMPACT
+  {
+    ayumi_sample last[] = {ay->dc_left.last, ay->dc_right.last};
+    COUNT_SAMPLE_SUBNORMALS(count, last);
+  }
+#else
+  COUNT_SAMPLE_SUBNORMALS(count, ay->dc_left.delay);
+  COUNT_SAMPLE_SUBNORMALS(count, ay->dc_right.delay);
+#endif
+  COUNT_SUBNORMALS(count, s->level);
+  COUNT_SUBNORMALS(count, s->dc_sum);
+  for (j = 0; j < 4; j += 1) {
+    COUNT_SUBNORMALS(count, s->y[j]);
+  }
+  for (j = 0; j < 3; j += 1) {
+    COUNT_SUBNORMALS(count, s->c[j]);
+  }
+  for (j = 0; j < AYUMI_FIR_MAX * 2; j += 1) {
+    COUNT_SUBNORMALS(count, s->fir[j]);
+  }
+#ifdef AYUMI_COMPACT
+  COUNT_SUBNORMALS(count, s->dc_last);
+#else
+  for (j = 0; j < DC_FILTER_SIZE; j += 1) {
+    COUNT_SUBNORMALS(count, s->dc_delay[j]);
+  }
+#endif
+  return count;
+}
+
+/*
+ * The same tail through the core linked in here, with the state scanned
+ * after every block: the plugin keeps its filters to itself.
+ */
+static long core_tail(const struct options* opt, int engine, int quality, int stems) {
+  static struct ayumi ay;
+  static struct ayumi_stems s;
+  float* none[TONE_CHANNELS] = {NULL, NULL, NULL};
+  long long position;
+  long long frames = (long long) ((opt->tail + 1) * opt->sample_rate);
+  long subnormals = 0;
+  int i;
+  ayumi_configure(&ay, 1, 2000000, opt->sample_rate);
+  ayumi_set_engine(&ay, engine);
+  ayumi_set_quality(&ay, quality);
+  memset(&s, 0, sizeof(s));
+  ayumi_stems_configure(&s, &ay);
+  for (position = 0; position < frames; position += TAIL_BLOCK) {
+    for (i = 0; i < TONE_CHANNELS; i += 1) {
+      if (position < opt->sample_rate) {
+        ayumi_set_tone(&ay, i, random_int(4096));
+        ayumi_set_mixer(&ay, i, random_int(2), random_int(2), random_int(2));
+        ayumi_set_volume(&ay, i, random_int(16));
+        ayumi_set_envelope(&ay, random_int(1024));
+      } else {
+        ayumi_set_mixer(&ay, i, 1, 1, 0);
+        ayumi_set_volume(&ay, i, 0);
+      }
+    }
+    if (stems) {
+      ayumi_process_stems(&ay, &s, none, outputs[0], outputs[1], TAIL_BLOCK, 1);
+    } else {
+      ayumi_process_block(&ay, outputs[0], outputs[1], TAIL_BLOCK, 1);
+    }
+    subnormals += scan_state(&ay, &s);
+  }
+  return subnormals;
+}
+
+/* Returns the number of calls that must not happen in run() */
+static int report_violations(void) {
+  Dl_info info;
+  int i, total = 0;
+  int count;
+  void* caller;
+  for (i = 0; i < CALL_COUNT; i += 1) {
+    count = atomic_load(&violations[i]);
+    if (!count) {
+      continue;
+    }
+    caller = (void*) atomic_load(&callers[i]);
+    if (dladdr(caller, &info) && info.dli_sname) {
+      printf("  %-24s %8d calls, first from %s\n", call_names[i], count, info.dli_sname);
+    } else {
+      printf("  %-24s %8d calls, first from %p\n", call_names[i], count, caller);
+    }
+    total += count;
+  }
+  if (!total) {
+    printf("  none\n");
+  }
+  return total;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr,
+    "Usage: %s [options] plugin.so\n"
+    "Runs the plugin over block sizes, event densities and instance counts, and fails\n"
+    "on allocations or locks in run(), subnormals in the silent tail, or a run over budget\n"
+    "  -u index    plugin of the library, 0 stereo, 1 stems (0)\n"
+    "  -r rate     sample rate (48000)\n"
+    "  -d seconds  audio per instance and configuration (1)\n"
+    "  -t seconds  silent tail checked for subnormals (20)\n"
+    "  -c chips    chips per instance (1)\n"
+    "  -q quality  draft, standard or high (standard)\n"
+    "  -m engine   fir or blep (fir)\n"
+    "  -k          render at the capped rate and upsample, from 88.2 kHz\n"
+    "  -l percent  worst run allowed, as a share of the block duration (no limit)\n", name);
+}
+
+int main(int argc, char** argv) {
+  static struct options opt;
+  static const int engines[] = {AYUMI_ENGINE_FIR, AYUMI_ENGINE_FIR, AYUMI_ENGINE_FIR, AYUMI_ENGINE_BLEP};
+  static const int qualities[] = {AYUMI_QUALITY_DRAFT, AYUMI_QUALITY_STANDARD, AYUMI_QUALITY_HIGH,
+    AYUMI_QUALITY_STANDARD};
+  static const char* engine_names[] = {"fir draft", "fir standard", "fir high", "blep"};
+  void* library;
+  LV2_Descriptor_Function descriptor;
+  int index = 0;
+  int opt_char, b, d, n, e, stems;
+  int over = 0;
+  long subnormals = 0, state;
+  double first, last;
+  opt.sample_rate = 48000;
+  opt.seconds = 1;
+  opt.tail = 20;
+  opt.chips = 1;
+  opt.quality = AYUMI_QUALITY_STANDARD;
+  opt.engine = AYUMI_ENGINE_FIR;
+  while ((opt_char = getopt(argc, argv, "u:r:d:t:c:q:m:kl:")) != -1) {
+    switch (opt_char) {
+    case 'u':
+      index = atoi(optarg);
+      break;
+    case 'r':
+      opt.sample_rate = atoi(optarg);
+      break;
+    case 'd':
+      opt.seconds = atof(optarg);
+      break;
+    case 't':
+      opt.tail = atof(optarg);
+      break;
+    case 'c':
+      opt.chips = atoi(optarg);
+      break;
+    case 'q':
+      opt.quality = !strcmp(optarg, "draft") ? AYUMI_QUALITY_DRAFT
+        : !strcmp(optarg, "high") ? AYUMI_QUALITY_HIGH : AYUMI_QUALITY_STANDARD;
+      break;
+    case 'm':
+      opt.engine = !strcmp(optarg, "blep") ? AYUMI_ENGINE_BLEP : AYUMI_ENGINE_FIR;
+      break;
+    case 'k':
+      opt.render_rate = 1;
+      break;
+    case 'l':
+      opt.budget = atof(optarg) / 100;
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (optind != argc - 1 || opt.sample_rate <= 0 || opt.seconds <= 0 || opt.tail < 2) {
+    usage(argv[0]);
+    return 1;
+  }
+  library = dlopen(argv[optind], RTLD_NOW);
+  descriptor = library ? (LV2_Descriptor_Function) dlsym(library, "lv2_descriptor") : NULL;
+  opt.plugin = descriptor ? descriptor(index) : NULL;
+  if (!opt.plugin) {
+    fprintf(stderr, "%s: cannot load plugin %d\n", argv[optind], index);
+    return 1;
+  }
+  printf("%s at %d Hz, %g chips per instance, %g s per configuration\n", opt.plugin->URI,
+    opt.sample_rate, opt.chips, opt.seconds);
+  printf("block events instances     runs   p50 us   p99 us p99.9 us    max us  of block\n");
+  for (b = 0; b < (int) (sizeof(block_sizes) / sizeof(int)); b += 1) {
+    for (d = 0; d < (int) (sizeof(event_spacings) / sizeof(int)); d += 1) {
+      for (n = 0; n < (int) (sizeof(instance_counts) / sizeof(int)); n += 1) {
+        over += measure(&opt, block_sizes[b], d, instance_counts[n], &subnormals);
+      }
+    }
+  }
+  subnormals += plugin_tail(&opt, &first, &last);
+  printf("\nallocations and locks in run():\n");
+  n = report_violations();
+  printf("\nsubnormal output samples: %ld\n", subnormals);
+  printf("tail of %g s: %.2f us per run in the first second, %.2f us in the last\n", opt.tail,
+    first * 1e6, last * 1e6);
+  printf("subnormals in the core filter state over the tail:\n");
+  for (e = 0; e < 4; e += 1) {
+    for (stems = 0; stems < 2; stems += 1) {
+      if (stems && engines[e] == AYUMI_ENGINE_BLEP) {
+        continue; /* the stems always go through the FIR */
+      }
+      state = core_tail(&opt, engines[e], qualities[e], stems);
+      printf("  %-13s %-6s %ld\n", engine_names[e], stems ? "stems" : "stereo", state);
+      subnormals += state;
+    }
+  }
+  return n || subnormals || over;
+}
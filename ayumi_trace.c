@@ -0,0 +1,290 @@
+/* Register trace ring buffer and file format */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "ayumi_trace.h"
+
+/* Records encoded per fwrite by ayumi_trace_drain */
+#define DRAIN_BATCH 256
+
+/*
+ * Single producer, single consumer. head is only written by the audio
+ * thread and tail by the draining one, each on its own cache line.
+ */
+struct ayumi_trace {
+  atomic_uint head;
+  unsigned lost; /* records dropped since the last push, producer only */
+  uint64_t lost_frame; /* of the first of them */
+  atomic_uint tail AYUMI_CACHE_LINE;
+  unsigned mask;
+  struct ayumi_trace_record* records;
+};
+
+/* capacity is rounded up to a power of two */
+struct ayumi_trace* ayumi_trace_create(int capacity) {
+  struct ayumi_trace* t;
+  unsigned size = 16;
+  while (size < (unsigned) capacity) {
+    size <<= 1;
+  }
+  t = aligned_alloc(64, sizeof(struct ayumi_trace));
+  if (!t) {
+    return NULL;
+  }
+  memset(t, 0, sizeof(struct ayumi_trace));
+  t->records = malloc(size * sizeof(struct ayumi_trace_record));
+  if (!t->records) {
+    free(t);
+    return NULL;
+  }
+  atomic_init(&t->head, 0);
+  atomic_init(&t->tail, 0);
+  t->mask = size - 1;
+  return t;
+}
+
+void ayumi_trace_destroy(struct ayumi_trace* t) {
+  if (!t) {
+    return;
+  }
+  free(t->records);
+  free(t);
+}
+
+/*
+ * Returns 0 and counts the record as lost when the ring is full. The next
+ * push that fits is preceded by an AYUMI_TRACE_DROPPED record at the frame
+ * of the first lost one, so a replay knows where it stopped being exact.
+ */
+int ayumi_trace_push(struct ayumi_trace* t, const struct ayumi_trace_record* r) {
+  unsigned head = atomic_load_explicit(&t->head, memory_order_relaxed);
+  unsigned tail = atomic_load_explicit(&t->tail, memory_order_acquire);
+  unsigned needed = t->lost ? 2 : 1;
+  struct ayumi_trace_record* slot;
+  if (head - tail + needed > t->mask + 1) {
+    if (!t->lost) {
+      t->lost_frame = r->frame;
+    }
+    t->lost += 1;
+    return 0;
+  }
+  if (t->lost) {
+    slot = &t->records[head & t->mask];
+    memset(slot, 0, sizeof(struct ayumi_trace_record));
+    slot->frame = t->lost_frame;
+    slot->op = AYUMI_TRACE_DROPPED;
+    slot->value.i = t->lost;
+    t->lost = 0;
+    head += 1;
+  }
+  t->records[head & t->mask] = *r;
+  atomic_store_explicit(&t->head, head + 1, memory_order_release);
+  return 1;
+}
+
+int ayumi_trace_pending(struct ayumi_trace* t) {
+  return atomic_load_explicit(&t->head, memory_order_acquire)
+    - atomic_load_explicit(&t->tail, memory_order_relaxed);
+}
+
+static void put_le32(uint8_t* p, uint32_t x) {
+  p[0] = x;
+  p[1] = x >> 8;
+  p[2] = x >> 16;
+  p[3] = x >> 24;
+}
+
+static uint32_t le32(const uint8_t* p) {
+  return ((uint32_t) p[3] << 24) | (p[2] << 16) | (p[1] << 8) | p[0];
+}
+
+static void encode(uint8_t* p, const struct ayumi_trace_record* r) {
+  put_le32(p, (uint32_t) r->frame);
+  put_le32(p + 4, (uint32_t) (r->frame >> 32));
+  p[8] = r->op;
+  p[9] = r->chip;
+  p[10] = r->channel;
+  p[11] = r->flag;
+  put_le32(p + 12, (uint32_t) r->value.i);
+}
+
+/* Writes the pending records to f, returns how many or -1 on error */
+int ayumi_trace_drain(struct ayumi_trace* t, FILE* f) {
+  uint8_t buffer[DRAIN_BATCH * AYUMI_TRACE_RECORD_SIZE];
+  unsigned head = atomic_load_explicit(&t->head, memory_order_acquire);
+  unsigned tail = atomic_load_explicit(&t->tail, memory_order_relaxed);
+  int written = 0;
+  int n;
+  while (tail != head) {
+    for (n = 0; n < DRAIN_BATCH && tail != head; n += 1) {
+      encode(buffer + n * AYUMI_TRACE_RECORD_SIZE, &t->records[tail & t->mask]);
+      tail += 1;
+    }
+    atomic_store_explicit(&t->tail, tail, memory_order_release);
+    if (fwrite(buffer, AYUMI_TRACE_RECORD_SIZE, n, f) != (size_t) n) {
+      return -1;
+    }
+    written += n;
+  }
+  return written;
+}
+
+int ayumi_trace_write_header(FILE* f, int sample_rate, int flags) {
+  uint8_t h[AYUMI_TRACE_HEADER_SIZE];
+  memcpy(h, "AYTR", 4);
+  put_le32(h + 4, AYUMI_TRACE_VERSION);
+  put_le32(h + 8, sample_rate);
+  put_le32(h + 12, flags);
+  return fwrite(h, sizeof(h), 1, f) == 1 ? 0 : -1;
+}
+
+int ayumi_trace_read_header(FILE* f, int* sample_rate, int* flags) {
+  uint8_t h[AYUMI_TRACE_HEADER_SIZE];
+  if (fread(h, sizeof(h), 1, f) != 1 || memcmp(h, "AYTR", 4) || le32(h + 4) != AYUMI_TRACE_VERSION) {
+    return -1;
+  }
+  *sample_rate = le32(h + 8);
+  *flags = le32(h + 12);
+  return 0;
+}
+
+/* Returns 1 for a record, 0 at the end of the file */
+int ayumi_trace_read(FILE* f, struct ayumi_trace_record* r) {
+  uint8_t p[AYUMI_TRACE_RECORD_SIZE];
+  if (fread(p, sizeof(p), 1, f) != 1) {
+    return 0;
+  }
+  r->frame = le32(p) | ((uint64_t) le32(p + 4) << 32);
+  r->op = p[8];
+  r->chip = p[9];
+  r->channel = p[10];
+  r->flag = p[11];
+  r->value.i = (int32_t) le32(p + 12);
+  return 1;
+}
+
+/* Makes the call a record stands for, records that are not calls are ignored */
+void ayumi_trace_apply(struct ayumi* ay, const struct ayumi_trace_record* r, int sample_rate) {
+  int value = r->value.i;
+  switch (r->op) {
+  case AYUMI_TRACE_CONFIGURE:
+    ayumi_configure(ay, r->flag, r->value.f, sample_rate);
+    break;
+  case AYUMI_TRACE_RECONFIGURE:
+    ayumi_reconfigure(ay, r->flag, r->value.f, sample_rate);
+    break;
+  case AYUMI_TRACE_QUALITY:
+    ayumi_set_quality(ay, value);
+    break;
+  case AYUMI_TRACE_ENGINE:
+    ayumi_set_engine(ay, value);
+    break;
+  case AYUMI_TRACE_PAN:
+    ayumi_set_pan(ay, r->channel, r->value.f, r->flag);
+    break;
+  case AYUMI_TRACE_TONE:
+    ayumi_set_tone(ay, r->channel, value);
+    break;
+  case AYUMI_TRACE_NOISE:
+    ayumi_set_noise(ay, value);
+    break;
+  case AYUMI_TRACE_MIXER:
+    ayumi_set_mixer(ay, r->channel, value & 1, (value >> 1) & 1, (value >> 2) & 1);
+    break;
+  case AYUMI_TRACE_VOLUME:
+    ayumi_set_volume(ay, r->channel, value);
+    break;
+  case AYUMI_TRACE_ENVELOPE:
+    ayumi_set_envelope(ay, value);
+    break;
+  case AYUMI_TRACE_ENVELOPE_SHAPE:
+    ayumi_set_envelope_shape(ay, value);
+    break;
+  case AYUMI_TRACE_REMOVE_DC:
+    ayumi_remove_dc(ay);
+    break;
+  }
+}
+
+static int32_t* pack_ints(int32_t* w, const int* x, int count) {
+  int i;
+  for (i = 0; i < count; i += 1) {
+    *w++ = x[i];
+  }
+  return w;
+}
+
+/* Low word first, whatever the byte order of the host */
+static int32_t* pack_doubles(int32_t* w, const double* x, int count) {
+  uint64_t bits;
+  int i;
+  for (i = 0; i < count; i += 1) {
+    memcpy(&bits, &x[i], sizeof(bits));
+    *w++ = (int32_t) (uint32_t) bits;
+    *w++ = (int32_t) (uint32_t) (bits >> 32);
+  }
+  return w;
+}
+
+static const int32_t* unpack_ints(const int32_t* w, int* x, int count) {
+  int i;
+  for (i = 0; i < count; i += 1) {
+    x[i] = *w++;
+  }
+  return w;
+}
+
+static const int32_t* unpack_doubles(const int32_t* w, double* x, int count) {
+  uint64_t bits;
+  int i;
+  for (i = 0; i < count; i += 1) {
+    bits = (uint32_t) w[0] | ((uint64_t) (uint32_t) w[1] << 32);
+    memcpy(&x[i], &bits, sizeof(bits));
+    w += 2;
+  }
+  return w;
+}
+
+/*
+ * The fields of a state in declaration order as AYUMI_TRACE_STATE_WORDS
+ * words, the doubles bit for bit, so a replay loads exactly what was
+ * restored.
+ */
+void ayumi_trace_pack_state(const struct ayumi_state* s, int32_t* words) {
+  int32_t* w = words;
+  w = pack_ints(w, s->tone_period, TONE_CHANNELS);
+  w = pack_ints(w, s->tone_counter, TONE_CHANNELS);
+  w = pack_ints(w, s->tone, TONE_CHANNELS);
+  w = pack_ints(w, s->mixer, TONE_CHANNELS);
+  w = pack_ints(w, s->volume, TONE_CHANNELS);
+  w = pack_doubles(w, s->pan_left, TONE_CHANNELS);
+  w = pack_doubles(w, s->pan_right, TONE_CHANNELS);
+  w = pack_ints(w, &s->noise_period, 1);
+  w = pack_ints(w, &s->noise_counter, 1);
+  w = pack_ints(w, &s->noise, 1);
+  w = pack_ints(w, &s->envelope_period, 1);
+  w = pack_ints(w, &s->envelope_counter, 1);
+  w = pack_ints(w, &s->envelope_shape, 1);
+  w = pack_ints(w, &s->envelope_step, 1);
+  pack_doubles(w, &s->x, 1);
+}
+
+void ayumi_trace_unpack_state(struct ayumi_state* s, const int32_t* words) {
+  const int32_t* w = words;
+  w = unpack_ints(w, s->tone_period, TONE_CHANNELS);
+  w = unpack_ints(w, s->tone_counter, TONE_CHANNELS);
+  w = unpack_ints(w, s->tone, TONE_CHANNELS);
+  w = unpack_ints(w, s->mixer, TONE_CHANNELS);
+  w = unpack_ints(w, s->volume, TONE_CHANNELS);
+  w = unpack_doubles(w, s->pan_left, TONE_CHANNELS);
+  w = unpack_doubles(w, s->pan_right, TONE_CHANNELS);
+  w = unpack_ints(w, &s->noise_period, 1);
+  w = unpack_ints(w, &s->noise_counter, 1);
+  w = unpack_ints(w, &s->noise, 1);
+  w = unpack_ints(w, &s->envelope_period, 1);
+  w = unpack_ints(w, &s->envelope_counter, 1);
+  w = unpack_ints(w, &s->envelope_shape, 1);
+  w = unpack_ints(w, &s->envelope_step, 1);
+  unpack_doubles(w, &s->x, 1);
+}
@@ -0,0 +1,79 @@
+#ifndef AYUMI_TRACE_H
+#define AYUMI_TRACE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "ayumi.h"
+
+/*
+ * Register traces: every call a host makes into the core, stamped with
+ * the output frame it takes effect at. ayumi_trace_push is safe on the
+ * audio thread, it neither allocates nor locks, and another thread moves
+ * the records to a file with ayumi_trace_drain.
+ *
+ * The file is a 16 byte header ("AYTR", version, sample rate, flags)
+ * followed by 16 byte records, all little endian.
+ */
+enum {
+  AYUMI_TRACE_VERSION = 1,
+  AYUMI_TRACE_HEADER_SIZE = 16,
+  AYUMI_TRACE_RECORD_SIZE = 16,
+  AYUMI_TRACE_ALL_CHIPS = 0xFF,
+  AYUMI_TRACE_STATE_WORDS = 36 /* in a struct ayumi_state, doubles taking two */
+};
+
+/* Header flags */
+enum {
+  AYUMI_TRACE_STEMS = 1 /* rendered with ayumi_process_stems */
+};
+
+enum {
+  AYUMI_TRACE_CONFIGURE, /* flag is_ym, value.f clock rate */
+  AYUMI_TRACE_RECONFIGURE,
+  AYUMI_TRACE_QUALITY,
+  AYUMI_TRACE_ENGINE,
+  AYUMI_TRACE_PAN, /* flag is_eqp, value.f pan */
+  AYUMI_TRACE_TONE,
+  AYUMI_TRACE_NOISE,
+  AYUMI_TRACE_MIXER, /* tone off, noise off and envelope on in bits 0 to 2 */
+  AYUMI_TRACE_VOLUME,
+  AYUMI_TRACE_ENVELOPE,
+  AYUMI_TRACE_ENVELOPE_SHAPE,
+  AYUMI_TRACE_REMOVE_DC,
+  AYUMI_TRACE_CHIPS, /* chips rendered from here on, chip is unused */
+  AYUMI_TRACE_STOP, /* deactivated, the output so far ends at this frame */
+  AYUMI_TRACE_DROPPED, /* value.i records lost from this frame on */
+  AYUMI_TRACE_RESTORE, /* chip loads the state its STATE records carried */
+  AYUMI_TRACE_UPSAMPLE, /* value.i host frames per rendered frame from here on, chip is unused */
+  AYUMI_TRACE_STATE, /* channel is the index of value.i in a packed state */
+  AYUMI_TRACE_OP_COUNT
+};
+
+struct ayumi_trace_record {
+  uint64_t frame;
+  uint8_t op;
+  uint8_t chip; /* or AYUMI_TRACE_ALL_CHIPS */
+  uint8_t channel;
+  uint8_t flag;
+  union {
+    int32_t i;
+    float f;
+  } value;
+};
+
+struct ayumi_trace;
+
+struct ayumi_trace* ayumi_trace_create(int capacity);
+void ayumi_trace_destroy(struct ayumi_trace* t);
+int ayumi_trace_push(struct ayumi_trace* t, const struct ayumi_trace_record* r);
+int ayumi_trace_pending(struct ayumi_trace* t);
+int ayumi_trace_drain(struct ayumi_trace* t, FILE* f);
+
+int ayumi_trace_write_header(FILE* f, int sample_rate, int flags);
+int ayumi_trace_read_header(FILE* f, int* sample_rate, int* flags);
+int ayumi_trace_read(FILE* f, struct ayumi_trace_record* r);
+void ayumi_trace_apply(struct ayumi* ay, const struct ayumi_trace_record* r, int sample_rate);
+void ayumi_trace_pack_state(const struct ayumi_state* s, int32_t* words);
+void ayumi_trace_unpack_state(struct ayumi_state* s, const int32_t* words);
+
+#endif
@@ -0,0 +1,177 @@
+/* Polyphase interpolator from a capped render rate up to the host rate */
+
+#include <math.h>
+#include <string.h>
+#include "ayumi_upsample.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Kaiser window parameter for about 85 dB of image rejection */
+#define BETA 8.6
+
+typedef float upsample_lanes __attribute__((vector_size(16), aligned(sizeof(float)), may_alias));
+
+#define WIDTH ((int) (sizeof(upsample_lanes) / sizeof(float)))
+#define LANES(p) (*(const upsample_lanes*) (p))
+
+/* Modified Bessel function of the first kind, order 0 */
+static double bessel_i0(double x) {
+  double sum = 1;
+  double term = 1;
+  int k;
+  for (k = 1; term > sum * 1e-12; k += 1) {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+/* Largest whole factor that keeps the render rate at min_rate or above */
+int ayumi_upsample_factor(int sample_rate, int min_rate) {
+  int factor = min_rate > 0 ? sample_rate / min_rate : 1;
+  return factor < 1 ? 1 : factor > AYUMI_UPSAMPLE_MAX_FACTOR ? AYUMI_UPSAMPLE_MAX_FACTOR : factor;
+}
+
+/*
+ * Each phase gets every factor-th tap of the prototype, scaled to sum to
+ * 1 so a held level comes out unchanged.
+ */
+int ayumi_upsample_configure(struct ayumi_upsampler* u, int factor, int lanes) {
+  int n = AYUMI_UPSAMPLE_TAPS * factor;
+  double center = (n - 1) / 2.0;
+  double window = bessel_i0(BETA);
+  double taps[AYUMI_UPSAMPLE_TAPS];
+  double sum, x, w;
+  int p, t;
+  if (factor < 1 || factor > AYUMI_UPSAMPLE_MAX_FACTOR || lanes < 1 || lanes > AYUMI_UPSAMPLE_MAX_LANES) {
+    return 0;
+  }
+  memset(u, 0, sizeof(*u));
+  u->factor = factor;
+  u->lanes = lanes;
+  for (p = 0; p < factor; p += 1) {
+    sum = 0;
+    for (t = 0; t < AYUMI_UPSAMPLE_TAPS; t += 1) {
+      x = (t * factor + p - center) / factor;
+      w = 2 * (t * factor + p - center) / (n - 1);
+      taps[t] = (x == 0 ? 1 : sin(M_PI * x) / (M_PI * x)) * bessel_i0(BETA * sqrt(1 - w * w)) / window;
+      sum += taps[t];
+    }
+    for (t = 0; t < AYUMI_UPSAMPLE_TAPS; t += 1) {
+      u->taps[p][AYUMI_UPSAMPLE_TAPS - 1 - t] = (float) (taps[t] / sum);
+    }
+  }
+  ayumi_upsample_reset(u, NULL);
+  return 1;
+}
+
+/* Fills the history as if every lane had held its level, or silence */
+void ayumi_upsample_reset(struct ayumi_upsampler* u, const float* levels) {
+  int l, i;
+  for (l = 0; l < u->lanes; l += 1) {
+    for (i = 0; i < AYUMI_UPSAMPLE_TAPS; i += 1) {
+      u->history[l][i] = levels ? levels[l] : 0;
+    }
+  }
+  u->phase = u->factor;
+}
+
+/* Input frames process takes to produce count outputs */
+int ayumi_upsample_needed(const struct ayumi_upsampler* u, int count) {
+  int left = u->factor - u->phase;
+  return count <= left ? 0 : (count - left + u->factor - 1) / u->factor;
+}
+
+/*
+ * One output, even and odd taps summed apart and then together: the
+ * order every lane of filter_phase sums in, so an output comes out the
+ * same whichever of the two computes it.
+ */
+static float dot(const float* taps, const float* x) {
+  float even = 0;
+  float odd = 0;
+  int t;
+  for (t = 0; t < AYUMI_UPSAMPLE_TAPS; t += 2) {
+    even += taps[t] * x[t];
+    odd += taps[t + 1] * x[t + 1];
+  }
+  return even + odd;
+}
+
+/* Outputs of one phase for count consecutive inputs, factor apart in out */
+static void filter_phase(const float* taps, const float* x, float* out, int factor, int count) {
+  upsample_lanes even, odd;
+  int i, t, l;
+  for (i = 0; i + WIDTH <= count; i += WIDTH) {
+    even = LANES(x + i) * 0;
+    odd = even;
+    for (t = 0; t < AYUMI_UPSAMPLE_TAPS; t += 2) {
+      even += taps[t] * LANES(x + i + t);
+      odd += taps[t + 1] * LANES(x + i + t + 1);
+    }
+    even += odd;
+    for (l = 0; l < WIDTH; l += 1) {
+      out[(i + l) * factor] = even[l];
+    }
+  }
+  for (; i < count; i += 1) {
+    out[i * factor] = dot(taps, x + i);
+  }
+}
+
+/*
+ * Outputs of one pass: what is left of the newest input so far, whole
+ * groups of factor outputs for the new ones, then the start of a group.
+ * x is the window that ends with the newest input so far.
+ */
+static void run_lane(const struct ayumi_upsampler* u, const float* x, float* out, int count) {
+  int phase = u->phase;
+  int i = 0;
+  int groups, p;
+  for (; phase < u->factor && i < count; phase += 1, i += 1) {
+    out[i] = dot(u->taps[phase], x);
+  }
+  groups = (count - i) / u->factor;
+  for (p = 0; p < u->factor; p += 1) {
+    filter_phase(u->taps[p], x + 1, out + i + p, u->factor, groups);
+  }
+  i += groups * u->factor;
+  x += groups + 1;
+  for (phase = 0; i < count; phase += 1, i += 1) {
+    out[i] = dot(u->taps[phase], x);
+  }
+}
+
+/*
+ * Takes ayumi_upsample_needed(u, count) frames of every lane from in and
+ * writes count frames to the lanes of out that are not NULL. New inputs
+ * are copied after the history first, so the outputs never read what was
+ * just stored.
+ */
+void ayumi_upsample_process(struct ayumi_upsampler* u, float* const* in, float** out, int count) {
+  int taken = 0;
+  int done = 0;
+  int n, frames, left, l;
+  float* h;
+  while (done < count) {
+    n = count - done;
+    left = u->factor - u->phase;
+    if (ayumi_upsample_needed(u, n) > AYUMI_UPSAMPLE_BLOCK) {
+      n = left + AYUMI_UPSAMPLE_BLOCK * u->factor;
+    }
+    frames = ayumi_upsample_needed(u, n);
+    for (l = 0; l < u->lanes; l += 1) {
+      h = u->history[l];
+      memcpy(h + AYUMI_UPSAMPLE_TAPS, in[l] + taken, sizeof(float) * frames);
+      if (out[l]) {
+        run_lane(u, h, out[l] + done, n);
+      }
+      memmove(h, h + frames, sizeof(float) * AYUMI_UPSAMPLE_TAPS);
+    }
+    u->phase = n <= left ? u->phase + n : (n - left - 1) % u->factor + 1;
+    taken += frames;
+    done += n;
+  }
+}
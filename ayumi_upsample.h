@@ -0,0 +1,38 @@
+#ifndef AYUMI_UPSAMPLE_H
+#define AYUMI_UPSAMPLE_H
+
+/*
+ * Polyphase interpolator that brings chips rendered at a fraction of the
+ * host rate up to it by a whole factor. The prototype is a Kaiser windowed
+ * sinc cut at half the input rate with AYUMI_UPSAMPLE_TAPS taps per
+ * phase: flat up to 0.41 of the input rate, images 85 dB down from 0.59
+ * of it, and a delay of half the taps in input frames. Configuring
+ * designs the taps; reset and process neither allocate nor lock. The
+ * output does not depend on how it is split into blocks.
+ */
+enum {
+  AYUMI_UPSAMPLE_TAPS = 32,
+  AYUMI_UPSAMPLE_MAX_FACTOR = 8,
+  AYUMI_UPSAMPLE_MAX_LANES = 5,
+  AYUMI_UPSAMPLE_BLOCK = 256 /* input frames taken in one pass */
+};
+
+/*
+ * The taps of each phase are stored oldest input first, and so are the
+ * last inputs, followed by room for the new ones of a pass.
+ */
+struct ayumi_upsampler {
+  int factor;
+  int lanes;
+  int phase; /* next output of the newest input, factor once it is used up */
+  float taps[AYUMI_UPSAMPLE_MAX_FACTOR][AYUMI_UPSAMPLE_TAPS];
+  float history[AYUMI_UPSAMPLE_MAX_LANES][AYUMI_UPSAMPLE_TAPS + AYUMI_UPSAMPLE_BLOCK];
+};
+
+int ayumi_upsample_factor(int sample_rate, int min_rate);
+int ayumi_upsample_configure(struct ayumi_upsampler* u, int factor, int lanes);
+void ayumi_upsample_reset(struct ayumi_upsampler* u, const float* levels);
+int ayumi_upsample_needed(const struct ayumi_upsampler* u, int count);
+void ayumi_upsample_process(struct ayumi_upsampler* u, float* const* in, float** out, int count);
+
+#endif
@@ -1,11 +1,16 @@
 #!/bin/sh
+set -e
 
 if ! [ $LV2_INSTALL_PATH ] ; then
 LV2_INSTALL_PATH=`pwd`/dist
 fi
 echo "target directory: $LV2_INSTALL_PATH"
 
-clang -g ayumi-lv2.c ayumi.c -fPIC -lm -shared -o ayumi-lv2.so
+clang -g -O2 $CFLAGS ayumi-lv2.c ayumi.c ayumi_decimate.c ayumi_pool.c ayumi_trace.c ayumi_upsample.c -fPIC -lm -lpthread -shared -o ayumi-lv2.so
+clang -g -O2 $CFLAGS ayumi_render.c ayumi.c ayumi_decimate.c -lm -lpthread -o ayumi_render
+clang -g -O2 $CFLAGS ayumi_bench.c ayumi.c ayumi_decimate.c -lm -ldl -o ayumi_bench
+clang -g -O2 $CFLAGS ayumi_replay.c ayumi.c ayumi_decimate.c ayumi_trace.c ayumi_upsample.c -lm -o ayumi_replay
+clang -g -O2 $CFLAGS ayumi_rtcheck.c ayumi.c ayumi_decimate.c -lm -ldl -lpthread -o ayumi_rtcheck
 
 mkdir -p $LV2_INSTALL_PATH/ayumi-lv2
 cp ayumi-lv2.so ayumi-lv2.ttl manifest.ttl $LV2_INSTALL_PATH/ayumi-lv2